@@ -0,0 +1,42 @@
+#ifndef BENCHMARK_BENCHMARK_H
+#define BENCHMARK_BENCHMARK_H
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace bricks::benchmark {
+
+// Calls func `iterations` times and returns the mean time per call in
+// nanoseconds. func has to return a value so the work is not optimized away.
+template <typename Function>
+double measureNanosecondsPerCall(Function func, long long iterations)
+{
+    volatile long long sink{0};
+    auto start = std::chrono::steady_clock::now();
+    for (long long i = 0; i < iterations; ++i) {
+        sink = sink + static_cast<long long>(func(i));
+    }
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::nano> elapsed = end - start;
+    return elapsed.count() / static_cast<double>(iterations);
+}
+
+inline void report(const std::string& name, double nanosecondsPerCall)
+{
+    std::cout << std::left << std::setw(48) << name << std::right
+              << std::setw(10) << std::fixed << std::setprecision(2)
+              << nanosecondsPerCall << " ns/call\n";
+}
+
+void ballBenchmark();
+void ballBatchBenchmark();
+void brickColumnsBenchmark();
+void frameBufferBenchmark();
+void levelBenchmark();
+void physicsBenchmark();
+
+} // namespace bricks::benchmark
+
+#endif
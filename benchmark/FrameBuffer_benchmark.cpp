@@ -0,0 +1,37 @@
+#include "Benchmark.h"
+
+#include "FrameBuffer.h"
+
+namespace bricks::benchmark {
+
+void frameBufferBenchmark()
+{
+    constexpr long long iterations{5'000};
+    constexpr int width{780};
+    constexpr int height{540};
+
+    FrameBuffer frameBuffer{width, height};
+    std::vector<std::uint32_t> pixels(
+        static_cast<std::size_t>(width) * static_cast<std::size_t>(height));
+
+    report("clear 780x540 (fillSpanScalar)",
+           measureNanosecondsPerCall(
+               [&](long long i) {
+                   bricks::impl::fillSpanScalar(
+                       pixels.data(), pixels.size(),
+                       static_cast<std::uint32_t>(i));
+                   return pixels[static_cast<std::size_t>(i) %
+                                 pixels.size()];
+               },
+               iterations));
+    report("clear 780x540 (FrameBuffer::clear)",
+           measureNanosecondsPerCall(
+               [&](long long i) {
+                   frameBuffer.clear(static_cast<std::uint32_t>(i));
+                   return frameBuffer.pixels()[static_cast<std::size_t>(i) %
+                                               pixels.size()];
+               },
+               iterations));
+}
+
+} // namespace bricks::benchmark
@@ -0,0 +1,61 @@
+#include "Benchmark.h"
+
+#include "Level.h"
+#include "LevelParser.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace bricks::benchmark {
+
+void levelBenchmark()
+{
+    constexpr long long iterations{10};
+    constexpr int columns{400};
+    constexpr int rows{250};
+
+    auto folder = std::filesystem::temp_directory_path();
+    auto textFilename = (folder / "benchmark_100k.lvl").string();
+    auto binaryFilename = (folder / "benchmark_100k.blvl").string();
+    std::ostringstream text;
+    text << "W " << columns << " H " << rows + 10 << '\n';
+    for (int y = 0; y < rows; ++y) {
+        for (int x = 0; x < columns; ++x) {
+            text << "X " << x << " Y " << y << " W 1 H 1 HP "
+                 << 1 + (x + y) % 9 << '\n';
+        }
+    }
+    auto textLevel = text.str();
+    {
+        std::ofstream ofs{textFilename};
+        ofs << textLevel;
+    }
+    {
+        std::ofstream ofs{binaryFilename, std::ios::binary};
+        writeBinary(ofs, readFromFile(textFilename));
+    }
+
+    report("load 100k bricks (readFromFile)",
+           measureNanosecondsPerCall(
+               [&](long long) {
+                   return readFromFile(textFilename).bricks.size();
+               },
+               iterations));
+    report("parse 100k bricks in memory (parseLevel)",
+           measureNanosecondsPerCall(
+               [&](long long) { return parseLevel(textLevel).bricks.size(); },
+               iterations));
+    report("load 100k bricks (readFromBinaryFile)",
+           measureNanosecondsPerCall(
+               [&](long long) {
+                   return readFromBinaryFile(binaryFilename).bricks.size();
+               },
+               iterations));
+
+    std::filesystem::remove(textFilename);
+    std::filesystem::remove(binaryFilename);
+}
+
+} // namespace bricks::benchmark
@@ -0,0 +1,107 @@
+#include "../Benchmark.h"
+
+#include "game_objects/Ball.h"
+#include "game_objects/BallBatch.h"
+
+#include <vector>
+
+namespace bricks::benchmark {
+
+using Ball = game_objects::Ball;
+template <typename Real>
+using BallBatch = game_objects::BallBatch<Real>;
+
+using Angle = types::Angle;
+using Gravity = types::Gravity;
+using Height = types::Height;
+using Point = types::Point;
+using Velocity = types::Velocity;
+using Width = types::Width;
+
+namespace impl {
+
+std::vector<Ball> makeActiveBalls(int count)
+{
+    std::vector<Ball> balls;
+    for (int i = 0; i < count; ++i) {
+        balls.emplace_back(Point{10.0, 10.0}, Width{0.5}, Height{0.5},
+                           Velocity{15.0}, Angle{0.1 + i * 0.01},
+                           Gravity{1.0});
+        balls.back().activate();
+    }
+    return balls;
+}
+
+template <typename Real>
+BallBatch<Real> makeBallBatch(const std::vector<Ball>& balls)
+{
+    BallBatch<Real> batch;
+    for (const auto& ball : balls) {
+        batch.add(ball);
+    }
+    return batch;
+}
+
+} // namespace impl
+
+void ballBatchBenchmark()
+{
+    constexpr long long iterations{20'000};
+
+    auto balls = impl::makeActiveBalls(4096);
+    auto doubleBatch = impl::makeBallBatch<double>(balls);
+    auto floatBatch = impl::makeBallBatch<float>(balls);
+
+    // Ball::move evaluates sin and cos every move, BallBatch only when the
+    // angle changed. The turning batches change every angle before every
+    // move, like Ball::move they evaluate sin and cos for every ball.
+    report("move 4096 balls (Ball::move)",
+           measureNanosecondsPerCall(
+               [&](long long) {
+                   for (auto& ball : balls) {
+                       ball.move(1.0);
+                   }
+                   return balls.back().topLeft().y;
+               },
+               iterations));
+    report("move 4096 turning balls (BallBatch<double>)",
+           measureNanosecondsPerCall(
+               [&](long long i) {
+                   for (std::size_t ball = 0; ball < doubleBatch.size();
+                        ++ball) {
+                       doubleBatch.setAngle(
+                           ball, 0.1 + static_cast<double>(i % 7) * 0.01);
+                   }
+                   doubleBatch.move(1.0);
+                   return doubleBatch.y().back();
+               },
+               iterations));
+    report("move 4096 turning balls (BallBatch<float>)",
+           measureNanosecondsPerCall(
+               [&](long long i) {
+                   for (std::size_t ball = 0; ball < floatBatch.size();
+                        ++ball) {
+                       floatBatch.setAngle(
+                           ball, 0.1F + static_cast<float>(i % 7) * 0.01F);
+                   }
+                   floatBatch.move(1.0);
+                   return floatBatch.y().back();
+               },
+               iterations));
+    report("move 4096 balls (BallBatch<double>)",
+           measureNanosecondsPerCall(
+               [&](long long) {
+                   doubleBatch.move(1.0);
+                   return doubleBatch.y().back();
+               },
+               iterations));
+    report("move 4096 balls (BallBatch<float>)",
+           measureNanosecondsPerCall(
+               [&](long long) {
+                   floatBatch.move(1.0);
+                   return floatBatch.y().back();
+               },
+               iterations));
+}
+
+} // namespace bricks::benchmark
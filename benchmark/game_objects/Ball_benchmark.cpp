@@ -0,0 +1,144 @@
+#include "../Benchmark.h"
+
+#include "game_objects/Ball.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace bricks::benchmark {
+
+using Point = types::Point;
+using Quadrant = types::Quadrant;
+
+namespace impl {
+
+Quadrant mirrorVertical(Quadrant quadrant)
+{
+    switch (quadrant) {
+    case Quadrant::I:
+        return Quadrant::II;
+    case Quadrant::II:
+        return Quadrant::I;
+    case Quadrant::III:
+        return Quadrant::IV;
+    case Quadrant::IV:
+        break;
+    }
+    return Quadrant::III;
+}
+
+Quadrant mirrorHorizontal(Quadrant quadrant)
+{
+    switch (quadrant) {
+    case Quadrant::I:
+        return Quadrant::IV;
+    case Quadrant::II:
+        return Quadrant::III;
+    case Quadrant::III:
+        return Quadrant::II;
+    case Quadrant::IV:
+        break;
+    }
+    return Quadrant::I;
+}
+
+// Ball without gravity flying through a box and reflected from its borders
+// like types::Angle mirrors, with all trigonometry in Precision. Returns the
+// position after every tick.
+template <typename Precision>
+std::vector<Point> flyThroughBox(int ticks)
+{
+    constexpr double boxWidth{30.0};
+    constexpr double boxHeight{20.0};
+    constexpr double traveldWayPerTick{0.25};
+
+    Point p{3.0, 7.0};
+    auto quadrant = Quadrant::I;
+    auto quadrantAngle = static_cast<Precision>(37.0L * M_PI / 180.0L);
+    const auto rightAngle = static_cast<Precision>(M_PI / 2.0L);
+
+    std::vector<Point> positions;
+    positions.reserve(static_cast<std::size_t>(ticks));
+    for (int tick = 0; tick < ticks; ++tick) {
+        auto delta = game_objects::impl::calcDelta(quadrant, quadrantAngle,
+                                                   traveldWayPerTick);
+        p.x += delta.x;
+        p.y += delta.y;
+        if ((p.x >= boxWidth && delta.x > 0.0) ||
+            (p.x <= 0.0 && delta.x < 0.0)) {
+            quadrant = mirrorVertical(quadrant);
+            quadrantAngle = rightAngle - quadrantAngle;
+        }
+        if ((p.y >= boxHeight && delta.y > 0.0) ||
+            (p.y <= 0.0 && delta.y < 0.0)) {
+            quadrant = mirrorHorizontal(quadrant);
+            quadrantAngle = rightAngle - quadrantAngle;
+        }
+        positions.push_back(p);
+    }
+    return positions;
+}
+
+} // namespace impl
+
+void ballBenchmark()
+{
+    constexpr long long iterations{1'000'000};
+    constexpr int ticks{100'000};
+
+    auto angleAt = [](long long i) {
+        return static_cast<double>(i % 1571) / 1000.0;
+    };
+
+    report("calcDelta (long double)",
+           measureNanosecondsPerCall(
+               [&](long long i) {
+                   return game_objects::impl::calcDelta(
+                              Quadrant::II,
+                              static_cast<long double>(angleAt(i)), 0.5)
+                       .x;
+               },
+               iterations));
+    report("calcDelta (double)",
+           measureNanosecondsPerCall(
+               [&](long long i) {
+                   return game_objects::impl::calcDelta(
+                              Quadrant::II, angleAt(i), 0.5)
+                       .x;
+               },
+               iterations));
+    report("calcDelta (float)",
+           measureNanosecondsPerCall(
+               [&](long long i) {
+                   return game_objects::impl::calcDelta(
+                              Quadrant::II, static_cast<float>(angleAt(i)),
+                              0.5)
+                       .x;
+               },
+               iterations));
+
+    // Divergence from long double after flying 100k ticks through a box
+    auto reference = impl::flyThroughBox<long double>(ticks);
+    auto reportDivergence = [&reference](const std::string& name,
+                                         const std::vector<Point>& path) {
+        double maxDistance{0.0};
+        for (std::size_t i = 0; i < path.size(); ++i) {
+            maxDistance = std::max(
+                maxDistance, std::hypot(path[i].x - reference[i].x,
+                                        path[i].y - reference[i].y));
+        }
+        std::cout << std::left << std::setw(48) << name << std::right
+                  << std::setw(10) << std::scientific << std::setprecision(2)
+                  << maxDistance << " grid units\n";
+    };
+    reportDivergence("max divergence 100k ticks (double)",
+                     impl::flyThroughBox<double>(ticks));
+    reportDivergence("max divergence 100k ticks (float)",
+                     impl::flyThroughBox<float>(ticks));
+}
+
+} // namespace bricks::benchmark
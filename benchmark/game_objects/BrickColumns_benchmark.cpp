@@ -0,0 +1,88 @@
+#include "../Benchmark.h"
+
+#include "game_objects/Brick.h"
+#include "game_objects/BrickColumns.h"
+
+#include <vector>
+
+namespace bricks::benchmark {
+
+using Brick = game_objects::Brick;
+using BrickColumns = game_objects::BrickColumns;
+
+using Height = types::Height;
+using Hitpoints = types::Hitpoints;
+using Point = types::Point;
+using Width = types::Width;
+
+namespace impl {
+
+// Overlap test over the array of Brick objects as a baseline for the sweep.
+void sweepBricks(const std::vector<Brick>& bricks, const Point& topLeft,
+                 const Point& bottomRight, std::vector<std::size_t>& indices)
+{
+    indices.clear();
+    for (std::size_t i = 0; i < bricks.size(); ++i) {
+        const auto& brick = bricks[i];
+        auto brickTopLeft = brick.topLeft();
+        auto brickBottomRight = brick.bottomRight();
+        auto xOverlaps = brickTopLeft.x <= bottomRight.x &&
+                         topLeft.x <= brickBottomRight.x;
+        auto yOverlaps = brickTopLeft.y <= bottomRight.y &&
+                         topLeft.y <= brickBottomRight.y;
+        if (xOverlaps && yOverlaps && !brick.isDestroyed()) {
+            indices.push_back(i);
+        }
+    }
+}
+
+std::vector<Brick> makeBrickField(int columns, int rows)
+{
+    std::vector<Brick> bricks;
+    for (int y = 0; y < rows; ++y) {
+        for (int x = 0; x < columns; ++x) {
+            bricks.emplace_back(Point{x * 2.0, y * 1.0}, Width{2.0},
+                                Height{1.0}, Hitpoints{1 + (x + y) % 9});
+        }
+    }
+    return bricks;
+}
+
+} // namespace impl
+
+void brickColumnsBenchmark()
+{
+    constexpr long long iterations{20'000};
+
+    auto bricks = impl::makeBrickField(64, 64);
+    BrickColumns columns{bricks};
+    std::vector<std::size_t> indices;
+
+    auto areaAt = [](long long i) {
+        auto offset = static_cast<double>(i % 100);
+        return Point{offset, offset / 2.0};
+    };
+
+    report("overlap 4096 bricks (vector<Brick>)",
+           measureNanosecondsPerCall(
+               [&](long long i) {
+                   auto topLeft = areaAt(i);
+                   impl::sweepBricks(bricks, topLeft,
+                                     Point{topLeft.x + 8.0, topLeft.y + 4.0},
+                                     indices);
+                   return indices.size();
+               },
+               iterations));
+    report("overlap 4096 bricks (BrickColumns::sweep)",
+           measureNanosecondsPerCall(
+               [&](long long i) {
+                   auto topLeft = areaAt(i);
+                   columns.sweep(topLeft,
+                                 Point{topLeft.x + 8.0, topLeft.y + 4.0},
+                                 indices);
+                   return indices.size();
+               },
+               iterations));
+}
+
+} // namespace bricks::benchmark
@@ -0,0 +1,137 @@
+#include "../Benchmark.h"
+
+#include "game_objects/Ball.h"
+#include "game_objects/Brick.h"
+#include "game_objects/Physics.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace bricks::benchmark {
+
+using Ball = game_objects::Ball;
+using Brick = game_objects::Brick;
+using Intersection = game_objects::impl::Intersection;
+
+using Angle = types::Angle;
+using Gravity = types::Gravity;
+using Height = types::Height;
+using Hitpoints = types::Hitpoints;
+using Point = types::Point;
+using Velocity = types::Velocity;
+using Width = types::Width;
+
+namespace impl {
+
+// The vector based corner classification getIntersection used before the
+// bitmask. Kept here as the baseline of the measurement.
+bool allExpectedIntersectionsAreInIntersections(
+    const std::vector<Intersection>& expectedIntersections,
+    const std::vector<Intersection>& intersections)
+{
+    for (const auto& expectedIntersection : expectedIntersections) {
+        auto it = std::find(intersections.begin(), intersections.end(),
+                            expectedIntersection);
+        if (it == intersections.end()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Intersection getIntersectionWithVector(const Ball& ball, const Brick& obj)
+{
+    using namespace game_objects::impl;
+
+    std::vector<Intersection> intersections{};
+
+    if (topLeftIntersectsWithBottomRight(ball.topLeft(), obj.bottomRight(),
+                                         obj.topLeft())) {
+        intersections.push_back(Intersection::bottomRight);
+    }
+    if (topRightIntersectsWithBottomLeft(ball.topRight(), obj.bottomLeft(),
+                                         obj.topRight())) {
+        intersections.push_back(Intersection::bottomLeft);
+    }
+    if (bottomLeftIntersectsWithTopRight(ball.bottomLeft(), obj.topRight(),
+                                         obj.bottomLeft())) {
+        intersections.push_back(Intersection::topRight);
+    }
+    if (bottomRightIntersectsWithTopLeft(ball.bottomRight(), obj.topLeft(),
+                                         obj.bottomRight())) {
+        intersections.push_back(Intersection::topLeft);
+    }
+
+    if (intersections.empty()) {
+        return Intersection::none;
+    }
+    if (intersections.size() == 1) {
+        return intersections[0];
+    }
+    if (intersections.size() == 2) {
+        if (allExpectedIntersectionsAreInIntersections(
+                {Intersection::bottomLeft, Intersection::topLeft},
+                intersections)) {
+            return Intersection::left;
+        }
+        if (allExpectedIntersectionsAreInIntersections(
+                {Intersection::topLeft, Intersection::topRight},
+                intersections)) {
+            return Intersection::top;
+        }
+        if (allExpectedIntersectionsAreInIntersections(
+                {Intersection::topRight, Intersection::bottomRight},
+                intersections)) {
+            return Intersection::right;
+        }
+        if (allExpectedIntersectionsAreInIntersections(
+                {Intersection::bottomRight, Intersection::bottomLeft},
+                intersections)) {
+            return Intersection::bottom;
+        }
+    }
+    return Intersection::none;
+}
+
+// Balls placed around a brick so every intersection kind (and none) occurs.
+std::vector<Ball> makeBalls()
+{
+    std::vector<Ball> balls;
+    for (double y = 0.0; y <= 6.0; y += 0.5) {
+        for (double x = 0.0; x <= 8.0; x += 0.5) {
+            balls.emplace_back(Point{x, y}, Width{1.0}, Height{1.0},
+                               Velocity{10.0}, Angle{0.5}, Gravity{0.0});
+        }
+    }
+    return balls;
+}
+
+} // namespace impl
+
+void physicsBenchmark()
+{
+    constexpr long long iterations{10'000'000};
+
+    Brick brick{Point{2.0, 2.0}, Width{4.0}, Height{2.0}, Hitpoints{1}};
+    auto balls = impl::makeBalls();
+
+    auto ballAt = [&balls](long long i) -> const Ball& {
+        return balls[static_cast<std::size_t>(i) % balls.size()];
+    };
+
+    report("getIntersection (vector, before)",
+           measureNanosecondsPerCall(
+               [&](long long i) {
+                   return impl::getIntersectionWithVector(ballAt(i), brick);
+               },
+               iterations));
+    report("getIntersection (bitmask)",
+           measureNanosecondsPerCall(
+               [&](long long i) {
+                   return game_objects::impl::getIntersection(ballAt(i),
+                                                              brick);
+               },
+               iterations));
+}
+
+} // namespace bricks::benchmark
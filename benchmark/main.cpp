@@ -0,0 +1,11 @@
+#include "Benchmark.h"
+
+int main()
+{
+    bricks::benchmark::ballBenchmark();
+    bricks::benchmark::ballBatchBenchmark();
+    bricks::benchmark::brickColumnsBenchmark();
+    bricks::benchmark::frameBufferBenchmark();
+    bricks::benchmark::levelBenchmark();
+    bricks::benchmark::physicsBenchmark();
+}
@@ -1,13 +1,30 @@
 #ifndef AUDIODEVICE_H
 #define AUDIODEVICE_H
 
+#include "Sound.h"
+#include "SoundQueue.h"
+
 #include <SDL.h>
 #include <SDL_mixer.h>
 
-#include <string>
+#include <array>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 namespace bricks {
 
+struct MixChunkDeleter {
+    void operator()(Mix_Chunk* chunk)
+    {
+        Mix_FreeChunk(chunk);
+    }
+};
+
+// Sounds are played on an own audio thread. playSound only queues the sound
+// and wakes the thread, which sleeps while nothing is queued. playSound must
+// always be called from the same thread.
 class AudioDevice {
 public:
     AudioDevice(int rate = 44100, Uint16 format = AUDIO_S16SYS,
@@ -19,17 +36,31 @@ public:
     AudioDevice& operator=(const AudioDevice&) = delete;
     AudioDevice& operator=(AudioDevice&&) = delete;
 
-    void playSound(const std::string& filename);
+    void playSound(Sound sound);
 
 private:
+    void loadSounds();
+    void playQueuedSounds();
+
     int mRate;
     Uint16 mFormat;
     int mChannels;
     int mBuffers;
 
-    Mix_Chunk* mChunk;
+    // All sounds are loaded once on construction, indexed by Sound.
+    std::array<std::unique_ptr<Mix_Chunk, MixChunkDeleter>, soundCount>
+        mChunks;
+
+    SoundQueue mQueue;
+    // Only guards the wake up, the queue itself is lock-free.
+    std::mutex mMutex;
+    std::condition_variable mSoundQueued;
+    bool mStop{false};
+    std::thread mAudioThread;
 };
 
+void play(AudioDevice& audioDevice, Sound sound);
+
 void playDestroyBrick(AudioDevice& audioDevice);
 void playHitBrick(AudioDevice& audioDevice);
 void playHitPlatform(AudioDevice& audioDevice);
@@ -0,0 +1,63 @@
+#ifndef BATCHRUNNER_H
+#define BATCHRUNNER_H
+
+#include "DifficultyParameters.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace bricks {
+
+class LevelCache;
+
+namespace utility {
+class ThreadPool;
+}
+
+// One headless game of a batch. The seed drives the simulated player.
+struct BatchJob {
+    DifficultyParameters difficultyParameters;
+    std::uint64_t seed{0};
+};
+
+struct LevelStatistics {
+    long long starts{0};
+    long long completions{0};
+    long long ticks{0};
+    long long lostBalls{0};
+    long long score{0};
+};
+
+struct BatchResult {
+    long long games{0};
+    long long gameOvers{0};
+    long long ticks{0};
+    // Index 0 holds level 1. Repeated playthroughs add to the same levels.
+    std::vector<LevelStatistics> levels;
+};
+
+struct BatchSettings {
+    long long maxTicks{100000};
+    double tickMS{16.0};
+    double missProbability{0.05};
+};
+
+// Runs every job as independent game on pool and sums up the statistics.
+// The result does not depend on the number of threads. The jobs share one
+// LevelCache, so every level file is read once.
+BatchResult runBatch(const std::vector<std::string>& levelFilenames,
+                     const std::vector<BatchJob>& jobs,
+                     const BatchSettings& settings, utility::ThreadPool& pool);
+
+BatchResult runBatchJob(const std::vector<std::string>& levelFilenames,
+                        const BatchJob& job, const BatchSettings& settings);
+BatchResult runBatchJob(const std::shared_ptr<LevelCache>& levels,
+                        const BatchJob& job, const BatchSettings& settings);
+
+void merge(BatchResult& result, const BatchResult& other);
+
+} // namespace bricks
+
+#endif
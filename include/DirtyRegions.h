@@ -0,0 +1,26 @@
+#ifndef DIRTYREGIONS_H
+#define DIRTYREGIONS_H
+
+#include "ScreenRect.h"
+
+#include <vector>
+
+namespace bricks {
+
+// Collects the screen areas which changed since the last frame. Overlapping
+// areas are merged into their bounding rect, so no pixel is redrawn twice.
+class DirtyRegions {
+public:
+    void add(const ScreenRect& rect);
+    void clear();
+
+    bool empty() const;
+    const std::vector<ScreenRect>& rects() const;
+
+private:
+    std::vector<ScreenRect> mRects;
+};
+
+} // namespace bricks
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef ENVIRONMENT_H
+#define ENVIRONMENT_H
+
+#include "DifficultyParameters.h"
+#include "Simulation.h"
+
+#include "game_objects/BallBatch.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace bricks {
+
+class LevelCache;
+
+namespace utility {
+class ThreadPool;
+}
+
+enum class Action { none, left, right, launch };
+
+struct StepResult {
+    // Score gained with the destroyed bricks.
+    long long reward{0};
+    bool done{false};
+    int lifes{0};
+};
+
+// Reinforcement learning view of a Simulation. The agent chooses one action
+// for a number of ticks and gets the reward of these ticks back. Pausing and
+// quitting are not possible.
+//
+// observe() writes observationHeaderSize values followed by the hitpoints of
+// every brick of the level in the order of Level::bricks:
+// ball x, ball y, ball angle, ball velocity, ball active (0 or 1),
+// platform x, platform y, platform width, grid width, grid height.
+// The size is the same for every level, the hitpoints of bricks a level does
+// not have are 0.
+class Environment {
+public:
+    static constexpr std::size_t observationHeaderSize{10};
+
+    explicit Environment(std::shared_ptr<LevelCache> levels,
+                         const DifficultyParameters& difficultyParameters = {},
+                         double tickMS = 16.0);
+    // For many environments of the same levels, maxBrickCount has to be
+    // levels->maxBrickCount().
+    Environment(std::shared_ptr<LevelCache> levels, std::size_t maxBrickCount,
+                const DifficultyParameters& difficultyParameters,
+                double tickMS);
+
+    void reset(std::uint64_t seed);
+    // Stops early if the game is over. Once done only reset() continues.
+    StepResult step(Action action, int ticks);
+    // One tick of step() in two halves like Simulation::startStep() and
+    // Simulation::finishStep(). startTick() returns false once done.
+    bool startTick(Action action);
+    void finishTick(const types::Point& ballEnd);
+
+    std::size_t observationSize() const;
+    // observation has to hold at least observationSize() values.
+    void observe(float* observation, std::size_t size) const;
+
+    const Simulation& simulation() const;
+
+private:
+    Simulation mSimulation;
+    double mTickMS;
+    std::size_t mMaxBrickCount;
+};
+
+// K environments stepped together, e.g. to get the actions of all of them
+// from one inference batch. Every tick the K balls are moved together in one
+// BallBatch before the collisions of every environment are handled. With a
+// pool the environments are stepped in parallel, the results are the same as
+// without.
+class VectorEnvironment {
+public:
+    VectorEnvironment(std::shared_ptr<LevelCache> levels, std::size_t count,
+                      const DifficultyParameters& difficultyParameters = {},
+                      double tickMS = 16.0,
+                      utility::ThreadPool* pool = nullptr);
+
+    std::size_t size() const;
+    const Environment& operator[](std::size_t index) const;
+
+    // One seed, action and result per environment.
+    void reset(const std::vector<std::uint64_t>& seeds);
+    void step(const std::vector<Action>& actions, int ticks,
+              std::vector<StepResult>& results);
+
+    // Size of the observation of one environment.
+    std::size_t observationSize() const;
+    // Writes the observations one after the other, observations has to hold
+    // at least size() * observationSize() values.
+    void observe(float* observations, std::size_t size) const;
+
+private:
+    void stepRange(const std::vector<Action>& actions, int ticks,
+                   std::vector<StepResult>& results, std::size_t first,
+                   std::size_t last);
+
+    std::vector<std::unique_ptr<Environment>> mEnvironments;
+    game_objects::BallBatch<double> mBalls;
+    std::vector<long long> mStartScores;
+    std::vector<unsigned char> mBallMoves;
+    utility::ThreadPool* mPool;
+    double mTickMS;
+};
+
+namespace impl {
+
+InputHandler::Event toEvent(Action action);
+
+} // namespace impl
+
+} // namespace bricks
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef EVENTPOLLER_H
+#define EVENTPOLLER_H
+
+#include "InputHandler.h"
+
+namespace bricks {
+
+InputHandler::Event pollEvent();
+
+} // namespace bricks
+
+#endif
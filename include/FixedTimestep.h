@@ -0,0 +1,37 @@
+#ifndef FIXEDTIMESTEP_H
+#define FIXEDTIMESTEP_H
+
+namespace bricks {
+
+namespace types {
+struct Point;
+}
+
+// Accumulates real elapsed time and hands it out in ticks of constant length,
+// so the simulation runs at the same speed no matter how fast frames are
+// rendered. Time longer than maxFrameMS is dropped to not spiral after a hitch.
+class FixedTimestep {
+public:
+    explicit FixedTimestep(double tickMS, double maxFrameMS = 250.0);
+
+    // Returns how many ticks are due after elapsedTimeMS passed.
+    int advance(double elapsedTimeMS);
+
+    double tickMS() const;
+
+    // Fraction of the next tick which already passed. Used to interpolate
+    // between the state before and after the last tick.
+    double alpha() const;
+
+private:
+    double mTickMS;
+    double mMaxFrameMS;
+    double mAccumulatorMS{0.0};
+};
+
+types::Point interpolate(const types::Point& previous,
+                         const types::Point& current, double alpha);
+
+} // namespace bricks
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include "ScreenRect.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+namespace bricks {
+
+namespace types {
+class RGBColor;
+}
+
+// RGBA image in memory, row by row from the top left. A pixel holds the bytes
+// r, g, b and a in this order in memory.
+class FrameBuffer {
+public:
+    FrameBuffer(int width, int height);
+
+    int width() const;
+    int height() const;
+
+    void clear(std::uint32_t pixel);
+    // Parts of rect outside of the frame buffer are skipped.
+    void fillRect(const ScreenRect& rect, std::uint32_t pixel);
+
+    std::uint32_t pixel(int x, int y) const;
+    const std::vector<std::uint32_t>& pixels() const;
+
+private:
+    int mWidth;
+    int mHeight;
+    std::vector<std::uint32_t> mPixels;
+};
+
+std::uint32_t toPixel(const types::RGBColor& color);
+types::RGBColor toRGBColor(std::uint32_t pixel);
+
+// Binary PPM (P6) without alpha. Several frames written to the same stream
+// can be read as image sequence, e.g. by ffmpeg -f image2pipe.
+void writePPM(std::ostream& os, const FrameBuffer& frameBuffer);
+// Only the RGBA bytes, e.g. for ffmpeg -f rawvideo -pix_fmt rgba.
+void writeRaw(std::ostream& os, const FrameBuffer& frameBuffer);
+
+namespace impl {
+
+void fillSpan(std::uint32_t* first, std::size_t count, std::uint32_t pixel);
+void fillSpanScalar(std::uint32_t* first, std::size_t count,
+                    std::uint32_t pixel);
+
+} // namespace impl
+
+} // namespace bricks
+
+#endif
@@ -2,77 +2,67 @@
 #define GAME_H
 
 #include <cstddef>
-#include <memory>
 
 #include "AudioDevice.h"
-#include "DifficultyParameters.h"
-#include "InputHandler.h"
-#include "Level.h"
+#include "FixedTimestep.h"
 #include "Renderer.h"
+#include "Replay.h"
+#include "Simulation.h"
 
+#include "types/Point.h"
+
+#include <cstdint>
 #include <string>
-#include <vector>
 
 namespace bricks {
 
-namespace game_objects {
-class Brick;
-class Ball;
-class Platform;
-class Wall;
-} // namespace game_objects
-
 class Game {
 public:
-    Game(std::size_t screenWidth, std::size_t screenHeight);
+    // The simulation always steps with 1000 / ticksPerSecond ms. Frames are
+    // rendered independently up to maxFramesPerSecond. With vsync they are
+    // also limited to the refresh rate of the display. With a
+    // recordFilename the game is saved as Replay when it is quit. A
+    // platformDeviation above 0 turns platform bounces randomly, see
+    // Simulation.
+    Game(std::size_t screenWidth, std::size_t screenHeight,
+         double ticksPerSecond = 60.0, double maxFramesPerSecond = 240.0,
+         RenderMode renderMode = RenderMode::full, bool vsync = false,
+         std::string recordFilename = "", double platformDeviation = 0.0);
 
     void run();
 
 private:
-    void runLevel();
-
-    bool allLevelsFinished();
-    void increaseDifficulty();
-
+    bool tick();
+    void render();
+    void rememberPositions();
+    void playSounds();
+    void saveHighscoreIfBeaten();
+    void saveReplayIfRecording();
     void updateValuesInTitleBar();
 
-    bool ballIsLost();
-    void handleBallCollisions();
-
-    long long getBrickScore(const game_objects::Brick& brick) const;
-    void awardExtraLifeIfThresholdReached();
-
-    DifficultyParameters mDifficultyParameters;
-    std::vector<std::string> mLevelFilenames;
-    Level mLevel;
+    Replay mReplay;
+    const std::string mRecordFilename;
+    Simulation mSimulation;
     Renderer mRenderer;
-    InputHandler mInputHandler;
     AudioDevice mAudioDevice;
+    FixedTimestep mTimestep;
+    const double mMSPerFrame;
 
-    static constexpr auto mStartLifes{5};
+    types::Point mPreviousBallTopLeft;
+    types::Point mPreviousPlatformTopLeft;
 
     long long mHighscore;
-    long long mScore{0};
-    long long mLastExtraLifeDivisor{0};
-    int mCurrentLevelIDX{1};
-    int mLifes{mStartLifes};
-    bool mGameOver = false;
 };
 
 long long loadHighscore();
 void saveHighscore(long long highscore);
 
+std::uint64_t makeSeed();
+
 std::string makeTitle(int level, int lifes, long long score,
                       long long highscore);
 
-bool allBricksAreDestroyed(const std::vector<game_objects::Brick> bricks);
-
-void delayToFramerate(double elapsedTimeInMS);
-
-Level loadLevel(const std::vector<std::string>& levelFilenames, int levelIDX);
-
-std::vector<std::string>
-getLevelFilenamesFromFolder(const std::string& folderName);
+void delayToFramerate(double elapsedTimeInMS, double msPerFrame);
 } // namespace bricks
 
-#endif
\ No newline at end of file
+#endif
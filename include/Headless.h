@@ -0,0 +1,52 @@
+#ifndef HEADLESS_H
+#define HEADLESS_H
+
+#include "InputHandler.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <vector>
+
+namespace bricks {
+
+class Level;
+class Simulation;
+
+using InputScript = std::function<InputHandler::Event(const Level& level)>;
+// Called after every step, e.g. to capture a frame.
+using TickCallback = std::function<void(const Simulation& simulation)>;
+
+struct HeadlessResult {
+    long long ticks{0};
+    long long score{0};
+    int level{1};
+    int lifes{0};
+    int playthroughs{0};
+    bool gameOver{false};
+};
+
+HeadlessResult runHeadless(Simulation& simulation, const InputScript& input,
+                           long long maxTicks, double tickMS = 16.0,
+                           const TickCallback& onTick = nullptr);
+
+InputScript makeScriptedInput(std::vector<InputHandler::Event> events);
+
+InputHandler::Event followBall(const Level& level);
+
+// Like followBall, but in missProbability of the ticks the platform stays
+// where it is. Games with different seeds play out differently.
+InputScript makeSloppyFollowBall(std::uint64_t seed, double missProbability);
+
+enum class FrameFormat { ppm, raw };
+
+// Renders the level with a SoftwareRenderer after every tick and writes the
+// frame to os, which has to outlive the returned callback.
+TickCallback makeFrameCapture(std::ostream& os, FrameFormat format,
+                              std::size_t screenWidth,
+                              std::size_t screenHeight);
+
+} // namespace bricks
+
+#endif
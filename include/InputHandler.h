@@ -13,7 +13,9 @@ class Platform;
 
 class InputHandler {
 public:
-    InputHandler();
+    enum class Event { none, quit, left, right, space, escape, p };
+
+    InputHandler() = default;
     ~InputHandler() = default;
 
     InputHandler(const InputHandler&) = delete;
@@ -21,17 +23,13 @@ public:
     InputHandler& operator=(const InputHandler&) = delete;
     InputHandler& operator=(InputHandler&&) = delete;
 
-    void handleInput(Level& level, double elapsedTimeMS);
+    void handleEvent(const Event& event, double elapsedTimeMS, Level& level);
 
     bool isPaused() const;
     bool changedPauseState() const;
     bool isQuit() const;
 
 private:
-    enum class Event { none, quit, left, right, space, escape, p };
-
-    static Event getEvent();
-    void handleEvent(const Event& event, double elapsedTimeMS, Level& level);
     void handleEvent(const Event& event, double elapsedTimeMS,
                      const game_objects::Wall& leftWall,
                      const game_objects::Wall& rightWall,
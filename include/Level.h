@@ -3,13 +3,18 @@
 
 #include "game_objects/Ball.h"
 #include "game_objects/Brick.h"
+#include "game_objects/BrickGrid.h"
 #include "game_objects/IndestructibleBrick.h"
+#include "game_objects/Physics.h"
 #include "game_objects/Platform.h"
 #include "game_objects/Wall.h"
 
 #include "DifficultyParameters.h"
 
+#include <cstddef>
+#include <cstdint>
 #include <iosfwd>
+#include <string>
 #include <vector>
 
 namespace bricks {
@@ -26,9 +31,8 @@ public:
     Level(const DifficultyParameters& difficultyParameters,
           const types::GridWidth& gridWidth,
           const types::GridHeight& gridHeight,
-          const std::vector<game_objects::Brick>& bricks_,
-          const std::vector<game_objects::IndestructibleBrick>&
-              indestructibleBricks_);
+          std::vector<game_objects::Brick> bricks_,
+          std::vector<game_objects::IndestructibleBrick> indestructibleBricks_);
 
     int gridWidth() const;
     int gridHeight() const;
@@ -36,11 +40,25 @@ public:
     game_objects::Wall leftWall() const;
     game_objects::Wall rightWall() const;
     game_objects::Wall topWall() const;
+    // left, right and top wall in this order
+    const std::vector<game_objects::Wall>& walls() const;
+
+    int aliveBrickCount() const;
+    bool allBricksDestroyed() const;
+    // Reflects the ball like game_objects::reflectFromGameObjects and counts
+    // the bricks it destroyed.
+    void reflectBall(std::vector<game_objects::Hit>& hits);
+    // Takes one hitpoint from the brick and counts it if it was destroyed.
+    void hitBrick(std::size_t index);
 
     void
     setDifficultyParameters(const DifficultyParameters& difficultyParameters);
     void resetBall();
     void resetPlatform();
+    // Brings the level back to the start without reading it again: all
+    // bricks get their start hitpoints, ball and platform their start
+    // positions. Nothing is allocated.
+    void reset();
 
 private:
     game_objects::Wall makeLeftWall() const;
@@ -56,9 +74,11 @@ private:
     DifficultyParameters mDifficultyParameters;
     int mGridWidth{0};
     int mGridHeight{0};
+    int mAliveBrickCount{0};
     game_objects::Wall mLeftWall;
     game_objects::Wall mRightWall;
     game_objects::Wall mTopWall;
+    std::vector<game_objects::Wall> mWalls;
 
 public:
     game_objects::Platform platform;
@@ -66,14 +86,52 @@ public:
 
     std::vector<game_objects::Brick> bricks;
     std::vector<game_objects::IndestructibleBrick> indestructibleBricks;
+
+    game_objects::BrickGrid brickGrid;
 };
 
 Level readFromFile(const std::string& filename);
 
 std::istream& operator>>(std::istream& is, Level& obj);
 
+// A binary level is an impl::BinaryLevelHeader followed by the records of
+// the bricks and then of the indestructible bricks, in native byte order. The
+// file is mapped into memory to load it, nothing has to be parsed.
+void writeBinary(std::ostream& os, const Level& level);
+Level readFromBinaryFile(const std::string& filename);
+Level readFromBinary(const unsigned char* data, std::size_t size);
+
+// Reads files ending with .blvl as binary and all others as text level.
+Level readLevel(const std::string& filename);
+
 namespace impl {
-bool isComment(const std::string line);
+
+struct BinaryLevelHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t gridWidth;
+    std::uint32_t gridHeight;
+    std::uint32_t brickCount;
+    std::uint32_t indestructibleBrickCount;
+};
+
+struct BinaryBrickRecord {
+    double x;
+    double y;
+    double width;
+    double height;
+    std::int32_t hitpoints;
+    std::int32_t reserved;
+};
+
+struct BinaryIndestructibleBrickRecord {
+    double x;
+    double y;
+    double width;
+    double height;
+};
+
+bool isBinaryLevelFilename(const std::string& filename);
 
 types::Point platformInitPosition(double platformWidth, double gridWidth,
                                   double gridHeight);
@@ -0,0 +1,49 @@
+#ifndef LEVELCACHE_H
+#define LEVELCACHE_H
+
+#include "Level.h"
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace bricks {
+
+// Reads every level file at most once and keeps the result as template.
+// Games get copies of the templates, so a restart or a new playthrough does
+// not touch the files again. Levels can be loaded on a background thread
+// ahead of time. All functions can be called from several threads.
+class LevelCache {
+public:
+    explicit LevelCache(std::vector<std::string> levelFilenames);
+
+    // Number of levels, levelIDX starts at 1
+    std::size_t size() const;
+
+    // Waits if the level is still being loaded. Rethrows the errors of
+    // loading it.
+    Level level(int levelIDX);
+    // Starts loading the level on a background thread if it is not loaded
+    // or loading yet.
+    void prefetch(int levelIDX);
+
+    // Largest number of bricks of all levels. Loads every level, but does
+    // not copy them.
+    std::size_t maxBrickCount();
+
+private:
+    using LevelFuture = std::shared_future<std::shared_ptr<const Level>>;
+
+    LevelFuture request(int levelIDX, std::launch policy);
+
+    std::vector<std::string> mLevelFilenames;
+    std::vector<LevelFuture> mLevels;
+    std::mutex mMutex;
+};
+
+} // namespace bricks
+
+#endif
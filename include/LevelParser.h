@@ -0,0 +1,81 @@
+#ifndef LEVELPARSER_H
+#define LEVELPARSER_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace bricks {
+
+class Level;
+
+// what() is "sourceName:line:column: reason", line and column start at 1.
+class LevelParseError : public std::runtime_error {
+public:
+    LevelParseError(const std::string& sourceName, int line, int column,
+                    const std::string& reason);
+
+    int line() const;
+    int column() const;
+
+private:
+    int mLine;
+    int mColumn;
+};
+
+// Parses a level in the text format directly from text. Tokens are views into
+// text and numbers are converted with std::from_chars, nothing is copied.
+// Empty lines and lines starting with # are skipped. sourceName is only used
+// in the messages of the errors.
+Level parseLevel(std::string_view text, const std::string& sourceName = "");
+
+namespace impl {
+
+// Splits text into lines of tokens separated by spaces or tabs.
+class LevelTokenizer {
+public:
+    LevelTokenizer(std::string_view text, std::string sourceName);
+
+    // Moves to the next line which is neither empty nor a comment. Returns
+    // false at the end of the text.
+    bool nextLine();
+    // Returns an empty view at the end of the line.
+    std::string_view nextToken();
+
+    // Position of the last token returned or of the end of the line
+    int line() const;
+    int column() const;
+
+    [[noreturn]] void fail(const std::string& reason) const;
+    [[noreturn]] void fail(int column, const std::string& reason) const;
+
+private:
+    std::string_view mText;
+    std::string mSourceName;
+    std::size_t mLineStart{0};
+    std::size_t mLineEnd{0};
+    std::size_t mNextLineStart{0};
+    std::size_t mPosition{0};
+    std::size_t mTokenStart{0};
+    int mLine{0};
+};
+
+template <typename Number> struct Field {
+    Number value;
+    int column;
+};
+
+// Reads keyword followed by a number.
+template <typename Number>
+Field<Number> parseField(LevelTokenizer& tokens, std::string_view keyword);
+
+void expectLineEnd(LevelTokenizer& tokens);
+
+bool isBlank(char c);
+
+} // namespace impl
+
+} // namespace bricks
+
+#endif
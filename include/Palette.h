@@ -0,0 +1,52 @@
+#ifndef PALETTE_H
+#define PALETTE_H
+
+#include "types/RGBColor.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace bricks {
+
+// A color together with the variants used for the bevel of a rect.
+struct Shades {
+    types::RGBColor base;
+    types::RGBColor lighter;
+    types::RGBColor darker;
+};
+
+enum class PaletteObject {
+    background,
+    ball,
+    platform,
+    wall,
+    indestructibleBrick
+};
+
+// All colors the renderer draws with, computed once. Every color exists a
+// second time in grayscale for the paused game.
+class Palette {
+public:
+    static constexpr int maxBrickHitpoints{9};
+
+    Palette();
+
+    const Shades& brick(int hitpoints, bool paused) const;
+    const Shades& object(PaletteObject object, bool paused) const;
+
+private:
+    static constexpr std::size_t objectCount{5};
+
+    // Appends all colors followed by all colors in grayscale.
+    static void addColors(std::vector<Shades>& shades,
+                          const std::vector<types::RGBColor>& colors);
+
+    std::vector<Shades> mBricks;
+    std::vector<Shades> mObjects;
+};
+
+Shades makeShades(const types::RGBColor& color);
+
+} // namespace bricks
+
+#endif
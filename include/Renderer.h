@@ -1,8 +1,12 @@
 #ifndef RENDERER_H
 #define RENDERER_H
 
+#include "DirtyRegions.h"
+#include "Palette.h"
+
 #include <SDL.h>
 
+#include <array>
 #include <memory>
 #include <string>
 #include <vector>
@@ -13,13 +17,13 @@ namespace game_objects {
 class Ball;
 class Platform;
 class Wall;
-class Brick;
+class BrickColumns;
 class IndestructibleBrick;
 class GameObject;
 } // namespace game_objects
 
 namespace types {
-class RGBColor;
+struct Point;
 }
 
 class Level;
@@ -38,11 +42,36 @@ struct SDLRendererDeleter {
     }
 };
 
+// Rects of one colour which are drawn together with a few SDL calls.
+struct RectBatch {
+    std::vector<SDL_Rect> fills;
+    std::vector<SDL_Rect> highlights;
+    std::vector<SDL_Rect> shadows;
+
+    void clear();
+    // Adds the rect with the same bevel Renderer::drawHighlights draws.
+    void add(const SDL_Rect& rect);
+};
+
+struct SDLTextureDeleter {
+    void operator()(SDL_Texture* texture)
+    {
+        SDL_DestroyTexture(texture);
+    }
+};
+
+// full clears and draws the whole screen every frame. incremental keeps the
+// last frame in a back buffer and only redraws the areas in which the ball,
+// the platform or bricks changed.
+enum class RenderMode { full, incremental };
+
 class Renderer {
 public:
+    // With vsync presenting a frame waits for the refresh of the display.
     Renderer(const std::size_t screenWidth, const std::size_t screenHeight,
-             const std::size_t gridWidth, const std::size_t gridHeight);
-    ~Renderer() = default;
+             const std::size_t gridWidth, const std::size_t gridHeight,
+             RenderMode renderMode = RenderMode::full, bool vsync = false);
+    ~Renderer();
 
     Renderer(const Renderer&) = delete;
     Renderer(Renderer&&) = delete;
@@ -51,37 +80,102 @@ public:
 
     void render(const Level& level);
 
+    // Draws ball and platform at the passed positions instead of the ones
+    // stored in level, e.g. interpolated between two simulation ticks.
+    void render(const Level& level, const types::Point& ballTopLeft,
+                const types::Point& platformTopLeft);
+
     void setWindowTitle(const std::string& title);
 
     void setPaused(bool paused);
 
+    // Must be called if another level is rendered, so the cached layers of
+    // the previous one are drawn again.
+    void invalidateLayers();
+    // Has to be called with the bricks hit since the last render. Only then
+    // the cached brick layer is drawn again.
+    void invalidateBricks(const std::vector<std::size_t>& brickIndices);
+
+    static SDL_Rect toSDLRect(const ScreenRect& rect);
+    static ScreenRect toScreenRect(const SDL_Rect& rect);
+
 private:
     void clearScreen();
+    const types::RGBColor& backgroundColor() const;
     void updateScreen();
 
+    // Called by SDL for every event, also for the ones pollEvent() drops.
+    static int watchRenderResets(void* userdata, SDL_Event* event);
+    // The contents of render targets are lost after a reset of them or of the
+    // device, after the latter also the textures themselves.
+    void handleRenderResets();
+    void createLayers();
+    std::unique_ptr<SDL_Texture, SDLTextureDeleter> createLayer();
+    void beginLayer(SDL_Texture* layer);
+    void endLayer();
+
+    void updateStaticLayer(const Level& level);
+    void updateBrickLayer(const game_objects::BrickColumns& brickColumns);
+    void copyLayers(const SDL_Rect* rect);
+    void renderStaticObjects(const Level& level);
+
+    void renderIncremental(const Level& level, const game_objects::Ball& ball,
+                           const game_objects::Platform& platform);
+    void redrawRegion(const SDL_Rect& rect, const game_objects::Ball& ball,
+                      const game_objects::Platform& platform);
+    void addChangedBricks(const game_objects::BrickColumns& brickColumns);
+
     void render(const game_objects::Ball& ball);
     void render(const game_objects::Platform& platform);
     void render(const game_objects::Wall& wall);
-    void render(const game_objects::Brick& brick);
+    void render(const game_objects::BrickColumns& brickColumns);
     void render(const game_objects::IndestructibleBrick& indestructibleBrick);
-    void render(const game_objects::GameObject& obj, types::RGBColor color);
+    void render(const game_objects::GameObject& obj, const Shades& shades);
+    void render(const SDL_Rect& rect, const Shades& shades);
 
-    void drawHighlights(const SDL_Rect& rect, const types::RGBColor& color);
+    void drawHighlights(const SDL_Rect& rect, const Shades& shades);
+    void fillRects(const std::vector<SDL_Rect>& rects,
+                   const types::RGBColor& color);
 
     SDL_Rect toSDLRect(const game_objects::GameObject& obj) const;
+    SDL_Rect toSDLRect(double x, double y, double width, double height) const;
+    // Includes the bevel which is drawn one pixel right and below the rect.
+    static SDL_Rect withBevel(const SDL_Rect& rect);
     void setDrawColor(const types::RGBColor& color);
-    static types::RGBColor getBrickDrawColor(const game_objects::Brick& brick);
 
     std::unique_ptr<SDL_Window, SDLWindowDeleter> mSdlWindow;
     std::unique_ptr<SDL_Renderer, SDLRendererDeleter> mSdlRenderer;
 
+    const Palette mPalette;
+
+    // Walls and indestructible bricks never change during a level and are
+    // drawn only once. The bricks only if one was hit. Without support
+    // for render targets both stay empty and everything is drawn every frame.
+    std::unique_ptr<SDL_Texture, SDLTextureDeleter> mStaticLayer;
+    std::unique_ptr<SDL_Texture, SDLTextureDeleter> mBrickLayer;
+    bool mStaticLayerDirty{true};
+    bool mBrickLayerDirty{true};
+    std::vector<std::size_t> mChangedBricks;
+
+    // Only created in RenderMode::incremental.
+    std::unique_ptr<SDL_Texture, SDLTextureDeleter> mBackBuffer;
+    DirtyRegions mDirtyRegions;
+    SDL_Rect mLastBallRect{0, 0, 0, 0};
+    SDL_Rect mLastPlatformRect{0, 0, 0, 0};
+
+    // One batch per brick color, kept to reuse the capacity every frame.
+    std::array<RectBatch, Palette::maxBrickHitpoints> mBrickBatches;
+
     const std::size_t mScreenWidth;
     const std::size_t mScreenHeight;
     const std::size_t mGridWidth;
     const std::size_t mGridHeight;
     const double mWidthFactor;
     const double mHeightFactor;
+    const RenderMode mRenderMode;
     bool mPaused{false};
+    bool mTargetsReset{false};
+    bool mDeviceReset{false};
 };
 
 } // namespace bricks
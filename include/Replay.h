@@ -0,0 +1,68 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "DifficultyParameters.h"
+#include "Headless.h"
+#include "InputHandler.h"
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace bricks {
+
+class Simulation;
+
+// Everything needed to play a game again tick by tick: the seed, the platform
+// deviation and the difficulty the Simulation was started with and the event
+// of every tick.
+// The levels are not part of the replay, it has to be played with the same
+// level files it was recorded with.
+struct Replay {
+    std::uint64_t seed{0};
+    double platformDeviation{0.0};
+    DifficultyParameters difficultyParameters;
+    double tickMS{16.0};
+    std::vector<InputHandler::Event> events;
+};
+
+// Binary format, all numbers little endian:
+// "BRKR", version byte, seed, platform deviation, 4 difficulty doubles,
+// tickMS, tick count, followed by runs of equal events, each an event byte
+// and a varint length.
+void writeReplay(std::ostream& os, const Replay& replay);
+Replay readReplay(std::istream& is);
+
+void saveReplay(const std::string& filename, const Replay& replay);
+Replay loadReplay(const std::string& filename);
+
+// Steps simulation with all events of the replay as fast as possible. Like
+// the game, the simulation is restarted after game over. simulation has to
+// be created with the seed, platform deviation and difficulty parameters of
+// the replay.
+HeadlessResult runReplay(Simulation& simulation, const Replay& replay,
+                         const TickCallback& onTick = nullptr);
+
+// Passes the events of input through and appends them to replay, which has
+// to outlive the returned script.
+InputScript makeRecordingInput(InputScript input, Replay& replay);
+
+namespace impl {
+
+void writeUInt64(std::ostream& os, std::uint64_t value);
+std::uint64_t readUInt64(std::istream& is);
+
+void writeDouble(std::ostream& os, double value);
+double readDouble(std::istream& is);
+
+void writeVarUInt(std::ostream& os, std::uint64_t value);
+std::uint64_t readVarUInt(std::istream& is);
+
+std::uint8_t readByte(std::istream& is);
+
+} // namespace impl
+
+} // namespace bricks
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef SCREENRECT_H
+#define SCREENRECT_H
+
+#include <array>
+
+namespace bricks {
+
+// Rect in screen pixels, independent of SDL so it can be used without window.
+struct ScreenRect {
+    int x{0};
+    int y{0};
+    int w{0};
+    int h{0};
+};
+
+bool operator==(const ScreenRect& a, const ScreenRect& b);
+bool operator!=(const ScreenRect& a, const ScreenRect& b);
+
+bool overlaps(const ScreenRect& a, const ScreenRect& b);
+ScreenRect unite(const ScreenRect& a, const ScreenRect& b);
+
+// Scales a rect in grid units by the screen size / grid size factors.
+ScreenRect toScreenRect(double x, double y, double width, double height,
+                        double widthFactor, double heightFactor);
+
+// Every object is drawn with a two pixel bevel, lighter on the left and top,
+// darker on the right and bottom. It reaches one pixel right and below rect.
+std::array<ScreenRect, 2> bevelHighlights(const ScreenRect& rect);
+std::array<ScreenRect, 2> bevelShadows(const ScreenRect& rect);
+ScreenRect withBevel(const ScreenRect& rect);
+
+} // namespace bricks
+
+#endif
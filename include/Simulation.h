@@ -0,0 +1,123 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include "DifficultyParameters.h"
+#include "InputHandler.h"
+#include "Level.h"
+#include "LevelCache.h"
+#include "Sound.h"
+
+#include "game_objects/Physics.h"
+#include "utility/Random.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace bricks {
+
+namespace game_objects {
+class Brick;
+} // namespace game_objects
+
+// Game rules without any SDL dependency. One call of step() advances the
+// level by one tick. Rendering, audio and the source of the input are left to
+// the caller. With a platformDeviation in radians above 0 the ball is turned
+// randomly by up to that angle on every bounce from the platform, the seed
+// makes these turns reproducible. By default the bounces are exact.
+// While a level is played the next one is loaded in the background.
+class Simulation {
+public:
+    explicit Simulation(
+        std::vector<std::string> levelFilenames, long long highscore = 0,
+        const DifficultyParameters& difficultyParameters = {},
+        std::uint64_t seed = 0, double platformDeviation = 0.0);
+    // Simulations sharing levels read every level file only once.
+    explicit Simulation(
+        std::shared_ptr<LevelCache> levels, long long highscore = 0,
+        const DifficultyParameters& difficultyParameters = {},
+        std::uint64_t seed = 0, double platformDeviation = 0.0);
+
+    void step(const InputHandler::Event& event, double elapsedTimeMS);
+    // step() in two halves, so the balls of many simulations can be moved
+    // together in between, e.g. with a BallBatch. If startStep() returns
+    // true the ball moves in this step and finishStep() has to be called
+    // with the top left Ball::move would move the ball to.
+    bool startStep(const InputHandler::Event& event, double elapsedTimeMS);
+    void finishStep(double elapsedTimeMS, const types::Point& ballEnd);
+    void restart();
+    // Like restart(), but the physics are seeded again first.
+    void restart(std::uint64_t seed);
+
+    const Level& level() const;
+    int currentLevel() const;
+    int lifes() const;
+    long long score() const;
+    long long highscore() const;
+    int playthroughs() const;
+
+    bool isPaused() const;
+    bool changedPauseState() const;
+    bool isQuit() const;
+    bool isGameOver() const;
+
+    // True if level, lifes, score or highscore changed in the last step.
+    bool statusChanged() const;
+    // Sounds triggered in the last step.
+    const std::vector<Sound>& sounds() const;
+    // Indices into level().bricks of the bricks hit in the last step.
+    const std::vector<std::size_t>& hitBricks() const;
+
+private:
+    void finishLevel();
+    // Playing the current level again only resets it.
+    void changeLevel(int levelIDX);
+    void prefetchNextLevel();
+
+    bool allLevelsFinished() const;
+    void increaseDifficulty();
+
+    bool ballIsLost() const;
+    // Moves the ball contact by contact, so it can't pass through objects.
+    // Until the first contact it moves to end.
+    void moveBall(double elapsedTimeMS, const types::Point& end);
+    void handleBallCollisions();
+
+    long long getBrickScore(const game_objects::Brick& brick) const;
+    void awardExtraLifeIfThresholdReached();
+
+    void emit(Sound sound);
+
+    DifficultyParameters mStartDifficultyParameters;
+    DifficultyParameters mDifficultyParameters;
+    std::shared_ptr<LevelCache> mLevels;
+    Level mLevel;
+    InputHandler mInputHandler;
+    std::vector<Sound> mSounds;
+    std::vector<std::size_t> mHitBricks;
+    std::vector<game_objects::Hit> mHits;
+    utility::Random mRandom;
+    const double mPlatformDeviation;
+
+    static constexpr auto mStartLifes{5};
+
+    long long mHighscore;
+    long long mScore{0};
+    long long mLastExtraLifeDivisor{0};
+    int mCurrentLevelIDX{1};
+    int mLifes{mStartLifes};
+    int mPlaythroughs{0};
+    bool mGameOver{false};
+    bool mStatusChanged{false};
+};
+
+// The sorted .lvl and .blvl files of the folder. If a level exists in both
+// formats only the .blvl file is returned.
+std::vector<std::string>
+getLevelFilenamesFromFolder(const std::string& folderName);
+
+} // namespace bricks
+
+#endif
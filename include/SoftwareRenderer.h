@@ -0,0 +1,60 @@
+#ifndef SOFTWARERENDERER_H
+#define SOFTWARERENDERER_H
+
+#include "FrameBuffer.h"
+#include "Palette.h"
+#include "ScreenRect.h"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace bricks {
+
+namespace game_objects {
+class BrickColumns;
+class GameObject;
+} // namespace game_objects
+
+namespace types {
+struct Point;
+}
+
+class Level;
+
+// Draws a level like Renderer but into a FrameBuffer in memory, so frames can
+// be captured without window or GPU.
+class SoftwareRenderer {
+public:
+    SoftwareRenderer(std::size_t screenWidth, std::size_t screenHeight,
+                     std::size_t gridWidth, std::size_t gridHeight);
+
+    void render(const Level& level);
+    void render(const Level& level, const types::Point& ballTopLeft,
+                const types::Point& platformTopLeft);
+
+    void setPaused(bool paused);
+
+    const FrameBuffer& frame() const;
+
+private:
+    void render(const game_objects::BrickColumns& brickColumns);
+    void render(const game_objects::GameObject& obj, const Shades& shades);
+    void render(const ScreenRect& rect, const Shades& shades);
+
+    ScreenRect toScreenRect(const game_objects::GameObject& obj) const;
+
+    FrameBuffer mFrame;
+    const Palette mPalette;
+    const double mWidthFactor;
+    const double mHeightFactor;
+    bool mPaused{false};
+
+    // Brick rects per hitpoints, kept to reuse the capacity every frame.
+    std::array<std::vector<ScreenRect>, Palette::maxBrickHitpoints>
+        mBrickRects;
+};
+
+} // namespace bricks
+
+#endif
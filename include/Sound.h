@@ -0,0 +1,23 @@
+#ifndef SOUND_H
+#define SOUND_H
+
+#include <cstddef>
+
+namespace bricks {
+
+enum class Sound {
+    destroyBrick,
+    hitBrick,
+    hitPlatform,
+    gameOver,
+    nextLevel,
+    lostBall,
+    extraLife,
+    winGame
+};
+
+constexpr std::size_t soundCount{static_cast<std::size_t>(Sound::winGame) + 1};
+
+} // namespace bricks
+
+#endif
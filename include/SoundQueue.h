@@ -0,0 +1,37 @@
+#ifndef SOUNDQUEUE_H
+#define SOUNDQUEUE_H
+
+#include "Sound.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+
+namespace bricks {
+
+// Lock-free ring buffer for exactly one thread calling push and one other
+// thread calling pop.
+class SoundQueue {
+public:
+    static constexpr std::size_t capacity{64};
+
+    // Returns false and drops the sound if the queue is full.
+    bool push(Sound sound);
+    std::optional<Sound> pop();
+
+    bool empty() const;
+
+private:
+    static_assert((capacity & (capacity - 1)) == 0,
+                  "capacity must be a power of two");
+
+    std::array<Sound, capacity> mSounds{};
+    // Both only ever grow, the slot is the position modulo capacity.
+    alignas(64) std::atomic<std::size_t> mPushPosition{0};
+    alignas(64) std::atomic<std::size_t> mPopPosition{0};
+};
+
+} // namespace bricks
+
+#endif
@@ -46,6 +46,13 @@ types::Point calcNewPosition(const types::Point& p, double velocity,
 double calcTraveldWay(double deltaTimeMS, double velocityInS);
 
 types::Point calcDelta(types::Angle angle, double sideC);
+
+// calcDelta with the sin and cos calculated in Precision instead of
+// types::Real. Instantiated for float, double and long double to compare
+// the precisions.
+template <typename Precision>
+types::Point calcDelta(types::Quadrant quadrant, Precision quadrantAngle,
+                       double sideC);
 } // namespace impl
 } // namespace bricks::game_objects
 #endif
\ No newline at end of file
@@ -0,0 +1,102 @@
+#ifndef GAME_OBJECTS_BALLBATCH_H
+#define GAME_OBJECTS_BALLBATCH_H
+
+#include "../types/Angle.h"
+#include "../types/Point.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace bricks::game_objects {
+
+class Ball;
+
+// Structure of arrays of many balls, e.g. one per environment, which are
+// moved together like Ball::move. Real is float or double.
+// The sin and cos of calcDelta are only calculated when the angle of a ball
+// changes and kept as direction per axis, so a move is a few multiplies and
+// adds per lane with SIMD. With double and types::Real double the positions
+// are the same as with Ball::move. An inactive ball moves with a velocity
+// and gravity of zero.
+template <typename Real>
+class BallBatch {
+public:
+    BallBatch() = default;
+
+    std::size_t size() const;
+
+    // Returns the index of the added ball.
+    std::size_t add(const Ball& ball);
+    // The sin and cos are only calculated again if the angle changed.
+    void set(std::size_t index, const Ball& ball);
+    // Takes over the position of the ball at index.
+    void copyTopLeftTo(std::size_t index, Ball& ball) const;
+
+    types::Point topLeft(std::size_t index) const;
+    void setTopLeft(std::size_t index, const types::Point& topLeft);
+    // angle in radians like types::Angle::get()
+    void setAngle(std::size_t index, Real angle);
+    void setVelocity(std::size_t index, Real velocity);
+    void setGravity(std::size_t index, Real gravity);
+
+    bool isActive(std::size_t index) const;
+    void activate(std::size_t index);
+
+    const std::vector<Real>& x() const;
+    const std::vector<Real>& y() const;
+    const std::vector<Real>& angle() const;
+    const std::vector<Real>& velocity() const;
+    const std::vector<Real>& gravity() const;
+
+    void move(double elapsedTimeInMS);
+    // Moves only the balls from first to last, e.g. one range per thread.
+    void move(double elapsedTimeInMS, std::size_t first, std::size_t last);
+
+private:
+    void updateDirection(std::size_t index, const types::Angle& angle);
+    void updateMoveVelocity(std::size_t index);
+
+    std::vector<Real> mX;
+    std::vector<Real> mY;
+    std::vector<Real> mAngle;
+    std::vector<Real> mVelocity;
+    std::vector<Real> mGravity;
+    std::vector<unsigned char> mIsActive;
+
+    // The angle the directions were calculated from
+    std::vector<types::Angle> mDirectionAngle;
+
+    // Like calcDelta for a way of 1
+    std::vector<Real> mDirectionX;
+    std::vector<Real> mDirectionY;
+    // Zero for inactive balls
+    std::vector<Real> mMoveVelocity;
+    std::vector<Real> mMoveGravity;
+};
+
+extern template class BallBatch<float>;
+extern template class BallBatch<double>;
+
+namespace impl {
+
+// The columns of a BallBatch a move reads and writes.
+template <typename Real>
+struct MoveColumns {
+    Real* x;
+    Real* y;
+    const Real* directionX;
+    const Real* directionY;
+    const Real* velocity;
+    const Real* gravity;
+};
+
+// Moves the balls from first to last without SIMD.
+template <typename Real>
+void moveScalar(const MoveColumns<Real>& columns, Real elapsedTimeInS,
+                std::size_t first, std::size_t last);
+
+} // namespace impl
+
+} // namespace bricks::game_objects
+
+#endif
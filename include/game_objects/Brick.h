@@ -24,6 +24,8 @@ public:
 
     void decreaseHitpoints();
     bool isDestroyed() const;
+    // Gives the brick its start hitpoints back.
+    void resetHitpoints();
 
 private:
     static int checkArgs(int hitpoints);
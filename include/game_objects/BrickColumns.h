@@ -0,0 +1,56 @@
+#ifndef GAME_OBJECTS_BRICKCOLUMNS_H
+#define GAME_OBJECTS_BRICKCOLUMNS_H
+
+#include "../types/Point.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace bricks::game_objects {
+
+class Brick;
+
+// Structure of arrays copy of the bricks of a level. The values needed for an
+// overlap test lie in contiguous arrays, so sweeping over thousands of bricks
+// runs with SIMD. A destroyed brick has zero hitpoints.
+class BrickColumns {
+public:
+    BrickColumns() = default;
+    explicit BrickColumns(const std::vector<Brick>& bricks);
+
+    std::size_t size() const;
+
+    const std::vector<double>& x() const;
+    const std::vector<double>& y() const;
+    const std::vector<double>& width() const;
+    const std::vector<double>& height() const;
+    const std::vector<int>& hitpoints() const;
+
+    void setHitpoints(std::size_t brickIndex, int hitpoints);
+
+    // Fills indices in ascending order with every not destroyed brick which
+    // overlaps the area. Touching borders count as overlap.
+    void sweep(const types::Point& topLeft, const types::Point& bottomRight,
+               std::vector<std::size_t>& indices) const;
+
+private:
+    std::vector<double> mX;
+    std::vector<double> mY;
+    std::vector<double> mWidth;
+    std::vector<double> mHeight;
+    std::vector<int> mHitpoints;
+};
+
+namespace impl {
+
+// Sweeps the bricks from first to the end without SIMD and appends the
+// results to indices.
+void sweepScalar(const BrickColumns& columns, const types::Point& topLeft,
+                 const types::Point& bottomRight, std::size_t first,
+                 std::vector<std::size_t>& indices);
+
+} // namespace impl
+
+} // namespace bricks::game_objects
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef GAME_OBJECTS_BRICKGRID_H
+#define GAME_OBJECTS_BRICKGRID_H
+
+#include "../types/Point.h"
+#include "BrickColumns.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace bricks::game_objects {
+
+class Brick;
+
+// Uniform grid with cells of one grid unit. Every cell holds the indices of
+// the not destroyed bricks which cover it, so a collision check only has to
+// look at the bricks close to the ball. Queries spanning more cells than there
+// are bricks sweep the BrickColumns instead.
+class BrickGrid {
+public:
+    BrickGrid() = default;
+    BrickGrid(int gridWidth, int gridHeight, const std::vector<Brick>& bricks);
+
+    int width() const;
+    int height() const;
+
+    const BrickColumns& columns() const;
+
+    // Takes over the hitpoints of a brick after it was hit.
+    void update(std::size_t brickIndex, const Brick& brick);
+    void remove(std::size_t brickIndex, const Brick& brick);
+    // Fills the cells again from the same bricks after their hitpoints were
+    // reset. Nothing is allocated unless more bricks are alive than when the
+    // grid was built.
+    void reset(const std::vector<Brick>& bricks);
+
+    const std::vector<std::size_t>& query(const types::Point& topLeft,
+                                          const types::Point& bottomRight);
+
+private:
+    struct CellRange {
+        int left;
+        int top;
+        int right;
+        int bottom;
+    };
+
+    CellRange cellRange(const types::Point& topLeft,
+                        const types::Point& bottomRight) const;
+    std::size_t cell(int x, int y) const;
+    void fillCells(const std::vector<Brick>& bricks);
+
+    int mWidth{0};
+    int mHeight{0};
+    // The indices of all cells are stored one cell after the other in
+    // mCellIndices, cell i starts at mCellStarts[i]. Removing a brick only
+    // shrinks mCellSizes, so building the grid needs three allocations.
+    std::vector<std::size_t> mCellStarts;
+    std::vector<std::size_t> mCellSizes;
+    std::vector<std::size_t> mCellIndices;
+    BrickColumns mColumns;
+
+    std::vector<std::size_t> mCandidates;
+    std::vector<unsigned> mVisitedStamps;
+    unsigned mStamp{0};
+};
+
+} // namespace bricks::game_objects
+
+#endif
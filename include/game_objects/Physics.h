@@ -1,7 +1,8 @@
 #ifndef GAME_OBJECTS_PHYSICS_H
 #define GAME_OBJECTS_PHYSICS_H
 
-#include <memory>
+#include <cstddef>
+#include <initializer_list>
 #include <optional>
 #include <vector>
 
@@ -10,9 +11,14 @@ class Angle;
 class Point;
 } // namespace bricks::types
 
+namespace bricks::utility {
+class Random;
+} // namespace bricks::utility
+
 namespace bricks::game_objects {
 
 class Ball;
+class BrickGrid;
 class GameObject;
 class Platform;
 class Brick;
@@ -36,32 +42,100 @@ enum class Intersection {
     bottomLeft
 };
 
-struct ObjectIntersectionPair {
-    std::unique_ptr<GameObject> object;
-    Intersection intersection;
-};
+using Corners = unsigned char;
+
+constexpr Corners cornerTopLeft{1U << 0U};
+constexpr Corners cornerTopRight{1U << 1U};
+constexpr Corners cornerBottomRight{1U << 2U};
+constexpr Corners cornerBottomLeft{1U << 3U};
 
 } // namespace impl
 
+enum class ObjectKind { wall, indestructibleBrick, brick };
+
+// Non-owning report of an object the ball intersected. index refers to the
+// vector of the kind of object that was passed in. object stays valid as long
+// as that vector is not resized.
+struct Hit {
+    const GameObject* object;
+    ObjectKind kind;
+    std::size_t index;
+    impl::Intersection intersection;
+};
+
 bool reflectFromPlatform(Ball& ball, const Platform& platform);
 
-std::vector<std::shared_ptr<GameObject>> reflectFromGameObjects(
+// Like above but turns the reflected ball by up to maxDeviation in either
+// direction. The deviation is drawn from random, so it is reproducible.
+bool reflectFromPlatform(Ball& ball, const Platform& platform,
+                         utility::Random& random,
+                         const types::Angle& maxDeviation);
+
+// hits is cleared and filled with all objects the ball was reflected from.
+// Passing the same vector every tick reuses its capacity. The hit bricks lose
+// a hitpoint, for the bricks of a Level use Level::reflectBall, which also
+// counts the destroyed ones.
+void reflectFromGameObjects(
+    Ball& ball, const std::vector<Wall>& walls,
+    const std::vector<IndestructibleBrick>& indestructibleBrick,
+    std::vector<Brick>& bricks, std::vector<Hit>& hits);
+
+void reflectFromGameObjects(
     Ball& ball, const std::vector<Wall>& walls,
     const std::vector<IndestructibleBrick>& indestructibleBrick,
-    std::vector<Brick>& bricks);
+    std::vector<Brick>& bricks, BrickGrid& brickGrid, std::vector<Hit>& hits);
+
+// Moves the ball along its way for elapsedTimeMS but stops at the first
+// contact with one of the objects, just inside of it, so the intersection can
+// be reflected. Returns the time in ms which is left to move.
+double moveToFirstContact(
+    Ball& ball, double elapsedTimeMS, const std::vector<Wall>& walls,
+    const std::vector<IndestructibleBrick>& indestructibleBricks,
+    const std::vector<Brick>& bricks, BrickGrid& brickGrid,
+    const Platform& platform);
+
+// Like above, with end as the top left Ball::move would move the ball to,
+// e.g. from a BallBatch.
+double moveToFirstContact(
+    Ball& ball, double elapsedTimeMS, const types::Point& end,
+    const std::vector<Wall>& walls,
+    const std::vector<IndestructibleBrick>& indestructibleBricks,
+    const std::vector<Brick>& bricks, BrickGrid& brickGrid,
+    const Platform& platform);
 
 namespace impl {
 
+// Returns the fraction of way after which the moving ball touches obj, if it
+// does so at all. Objects the ball already overlaps are ignored.
+std::optional<double> timeOfImpact(const Ball& ball, const types::Point& way,
+                                   const GameObject& obj);
+
+void updateTimeOfImpact(const Ball& ball, const types::Point& way,
+                        const GameObject& obj,
+                        std::optional<double>& firstTimeOfImpact);
+
 template <typename GameObjectType>
-std::vector<ObjectIntersectionPair>
-getObjectIntersectionPairs(const Ball& ball,
-                           std::vector<GameObjectType>& gameObjects);
+void updateTimeOfImpact(const Ball& ball, const types::Point& way,
+                        const std::vector<GameObjectType>& gameObjects,
+                        std::optional<double>& firstTimeOfImpact);
+
+template <typename GameObjectType>
+void addHits(const Ball& ball, const std::vector<GameObjectType>& gameObjects,
+             ObjectKind kind, std::vector<Hit>& hits);
+
+void addHits(const Ball& ball, std::vector<Brick>& bricks,
+             std::vector<Hit>& hits);
 
-std::vector<ObjectIntersectionPair>
-getObjectIntersectionPairs(const Ball& ball, std::vector<Brick>& bricks);
+void addHits(const Ball& ball, std::vector<Brick>& bricks,
+             BrickGrid& brickGrid, std::vector<Hit>& hits);
+
+void reflectFromHits(Ball& ball, const std::vector<Hit>& hits);
 
 Intersection getIntersection(const Ball& ball, const GameObject& obj);
 
+Corners getIntersectedCorners(const Ball& ball, const GameObject& obj);
+Intersection cornersToIntersection(Corners corners);
+
 bool bottomRightIntersectsWithTopLeft(const types::Point& bottomRight1,
                                       const types::Point& topLeft2,
                                       const types::Point& bottomRight2);
@@ -78,81 +152,51 @@ bool topRightIntersectsWithBottomLeft(const types::Point& topRight1,
                                       const types::Point& bottomLeft2,
                                       const types::Point& topRight2);
 
-bool intersectsLeft(const std::vector<Intersection>& intersections);
-bool intersectsTop(const std::vector<Intersection>& intersections);
-bool intersectsRight(const std::vector<Intersection>& intersections);
-bool intersectsBottom(const std::vector<Intersection>& intersections);
-
-bool allExpectedIntersectionsAreInIntersections(
-    const std::vector<Intersection>& expectedIntersections,
-    const std::vector<Intersection>& intersections);
-
 void reflectFromSinglePlatform(Ball& ball, const Platform& platform,
                                const Intersection& intersection);
 
 void reflectFromSingleObject(Ball& ball, const GameObject& obj,
                              const Intersection& intersection);
 
-void reflectFromMultipleObjects(
-    Ball& ball,
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
-
-bool reflectFromTwoObjectsInCorner(
-    Ball& ball,
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
-
-bool reflectFromThreeObjectsInCorner(
-    Ball& ball,
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
-
-bool intersectsInTopLeftCornerWithTwoObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
-bool intersectsInTopLeftCornerWithThreeObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
-void putBeforeIntersectsWithTopLeftCorner(
-    Ball& ball,
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
-
-bool intersectsInTopRightCornerWithTwoObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
-bool intersectsInTopRightCornerWithThreeObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
-void putBeforeIntersectsWithTopRightCorner(
-    Ball& ball,
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
-
-bool intersectsInBottomRightCornerWithTwoObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
+void reflectFromMultipleObjects(Ball& ball, const std::vector<Hit>& hits);
+
+bool reflectFromTwoObjectsInCorner(Ball& ball, const std::vector<Hit>& hits);
+
+bool reflectFromThreeObjectsInCorner(Ball& ball, const std::vector<Hit>& hits);
+
+bool intersectsInTopLeftCornerWithTwoObjects(const std::vector<Hit>& hits);
+bool intersectsInTopLeftCornerWithThreeObjects(const std::vector<Hit>& hits);
+void putBeforeIntersectsWithTopLeftCorner(Ball& ball,
+                                          const std::vector<Hit>& hits);
+
+bool intersectsInTopRightCornerWithTwoObjects(const std::vector<Hit>& hits);
+bool intersectsInTopRightCornerWithThreeObjects(const std::vector<Hit>& hits);
+void putBeforeIntersectsWithTopRightCorner(Ball& ball,
+                                           const std::vector<Hit>& hits);
+
+bool intersectsInBottomRightCornerWithTwoObjects(const std::vector<Hit>& hits);
 bool intersectsInBottomRightCornerWithThreeObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
-void putBeforeIntersectsWithBottomRightCorner(
-    Ball& ball,
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
-
-bool intersectsInBottomLeftCornerWithTwoObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
-bool intersectsInBottomLeftCornerWithThreeObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
-void putBeforeIntersectsWithBottomLeftCorner(
-    Ball& ball,
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
-
-bool intersectsFromLeftWithMultiObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
-bool intersectsFromTopWithMultiObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
-bool intersectsFromRightWithMultiObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
-bool intersectsFromBottomWithMultiObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
-
-bool objectIntersectionPairsContainOnlyValuesFromIntersectionList(
-    const std::vector<Intersection>& intersections,
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
-
-bool allIntersectionsAreInObjectIntersectionPairs(
-    const std::vector<Intersection>& intersections,
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs);
+    const std::vector<Hit>& hits);
+void putBeforeIntersectsWithBottomRightCorner(Ball& ball,
+                                              const std::vector<Hit>& hits);
+
+bool intersectsInBottomLeftCornerWithTwoObjects(const std::vector<Hit>& hits);
+bool intersectsInBottomLeftCornerWithThreeObjects(const std::vector<Hit>& hits);
+void putBeforeIntersectsWithBottomLeftCorner(Ball& ball,
+                                             const std::vector<Hit>& hits);
+
+bool intersectsFromLeftWithMultiObjects(const std::vector<Hit>& hits);
+bool intersectsFromTopWithMultiObjects(const std::vector<Hit>& hits);
+bool intersectsFromRightWithMultiObjects(const std::vector<Hit>& hits);
+bool intersectsFromBottomWithMultiObjects(const std::vector<Hit>& hits);
+
+bool hitsContainOnlyValuesFromIntersectionList(
+    std::initializer_list<Intersection> intersections,
+    const std::vector<Hit>& hits);
+
+bool allIntersectionsAreInHits(
+    std::initializer_list<Intersection> intersections,
+    const std::vector<Hit>& hits);
 
 void reflectFromCollisionWithLeft(Ball& ball, const GameObject& obj);
 void reflectFromCollisionWithTop(Ball& ball, const GameObject& obj);
@@ -188,7 +232,8 @@ bool isSmaller(double angle, double targetAngle, double delta);
 
 bool isBigger(double angle, double targetAngle, double delta);
 
-long double random(long double min, long double max);
+types::Angle deviate(const types::Angle& angle, utility::Random& random,
+                     const types::Angle& maxDeviation);
 
 } // namespace impl
 
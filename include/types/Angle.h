@@ -1,6 +1,8 @@
 #ifndef TYPES_ANGLE_H
 #define TYPES_ANGLE_H
 
+#include "Real.h"
+
 namespace bricks::types {
 
 enum class Quadrant { I, II, III, IV };
@@ -8,13 +10,13 @@ enum class Quadrant { I, II, III, IV };
 class Angle {
 public:
     Angle();
-    explicit Angle(long double angle);
+    explicit Angle(Real angle);
 
-    long double get() const;
-    void set(long double angle);
+    Real get() const;
+    void set(Real angle);
 
-    long double quadrantAngle() const;
-    void setQuadrantAngle(long double quadrantAngle);
+    Real quadrantAngle() const;
+    void setQuadrantAngle(Real quadrantAngle);
 
     Quadrant quadrant() const;
     void setQuadrant(Quadrant quadrant);
@@ -24,25 +26,25 @@ public:
 
 private:
     Quadrant mQuadrant;
-    long double mQuadrantAngle;
+    Real mQuadrantAngle;
 };
 
 namespace impl {
 
-long double mirrorQuadrantAngle(long double quadrantAngle);
+Real mirrorQuadrantAngle(Real quadrantAngle);
 
-Quadrant calcQuadrant(long double angle);
+Quadrant calcQuadrant(Real angle);
 
-bool isInQuadrantI(long double angle);
-bool isInQuadrantII(long double angle);
-bool isInQuadrantIII(long double angle);
-bool isInQuadrantIV(long double angle);
+bool isInQuadrantI(Real angle);
+bool isInQuadrantII(Real angle);
+bool isInQuadrantIII(Real angle);
+bool isInQuadrantIV(Real angle);
 
-long double angleToQuadrantAngle(long double angle, Quadrant quadrant);
+Real angleToQuadrantAngle(Real angle, Quadrant quadrant);
 
-long double quadrantAngleToAngle(long double quadrantAngle, Quadrant quadrant);
+Real quadrantAngleToAngle(Real quadrantAngle, Quadrant quadrant);
 
-long double calcAngleIfOutOfRange(long double angle);
+Real calcAngleIfOutOfRange(Real angle);
 
 } // namespace impl
 } // namespace bricks::types
@@ -0,0 +1,17 @@
+#ifndef TYPES_REAL_H
+#define TYPES_REAL_H
+
+namespace bricks::types {
+
+// Precision of angles and of the trigonometry of the ball movement. Set the
+// CMake option BRICKS_FLOAT to calculate them with float instead of double.
+// long double is not offered, on x86-64 it runs on the x87 unit which can't
+// be vectorised.
+#if defined(BRICKS_FLOAT)
+using Real = float;
+#else
+using Real = double;
+#endif
+
+} // namespace bricks::types
+#endif
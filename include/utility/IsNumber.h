@@ -1,12 +1,18 @@
 #ifndef UTILITY_ISNUMBER_H
 #define UTILITY_ISNUMBER_H
 
+#include <optional>
 #include <string>
+#include <string_view>
 
 namespace bricks::utility {
 
 template <typename T> bool isNumber(const std::string& s);
 
+// The whole of s has to be the number, an optional leading + is allowed.
+// Floating point numbers have to be finite.
+template <typename T> std::optional<T> parseNumber(std::string_view s);
+
 } // namespace bricks::utility
 
-#endif
\ No newline at end of file
+#endif
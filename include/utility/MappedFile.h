@@ -0,0 +1,30 @@
+#ifndef UTILITY_MAPPEDFILE_H
+#define UTILITY_MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+namespace bricks::utility {
+
+// Maps a whole file read only into memory for as long as the object lives.
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& filename);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    // nullptr for an empty file
+    const unsigned char* data() const;
+    std::size_t size() const;
+
+private:
+    const unsigned char* mData{nullptr};
+    std::size_t mSize{0};
+};
+
+} // namespace bricks::utility
+#endif
@@ -1,17 +1,20 @@
 #ifndef UTILITY_OPERATORDEGREE_H
 #define UTILITY_OPERATORDEGREE_H
 
+#include "../types/Real.h"
+
 #define _USE_MATH_DEFINES
 #include <cmath>
 
 namespace bricks::utility {
 
-constexpr long double deg2rad(long double degAngle)
+// Meant for constants, the long double is only used at compile time.
+constexpr types::Real deg2rad(long double degAngle)
 {
-    return degAngle * M_PI / 180.0L;
+    return static_cast<types::Real>(degAngle * M_PI / 180.0L);
 }
 
-constexpr long double operator"" _deg(long double degAngle)
+constexpr types::Real operator"" _deg(long double degAngle)
 {
     return deg2rad(degAngle);
 }
@@ -0,0 +1,49 @@
+#ifndef UTILITY_RANDOM_H
+#define UTILITY_RANDOM_H
+
+#include <cstdint>
+#include <limits>
+
+namespace bricks::utility {
+
+// xoshiro256** generator. Every Simulation owns its own instance, so the
+// same seed always produces the same game and parallel games share no state.
+// Satisfies UniformRandomBitGenerator to be usable with <random>.
+class Random {
+public:
+    using result_type = std::uint64_t;
+
+    explicit Random(std::uint64_t seed = 0);
+
+    void seed(std::uint64_t seed);
+
+    result_type operator()();
+
+    // Uniformly distributed in [min, max).
+    double uniform(double min, double max);
+    // True with the given probability.
+    bool chance(double probability);
+
+    static constexpr result_type min()
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+private:
+    std::uint64_t mState[4];
+};
+
+namespace impl {
+
+std::uint64_t splitMix64(std::uint64_t& state);
+
+std::uint64_t rotateLeft(std::uint64_t x, int k);
+
+} // namespace impl
+
+} // namespace bricks::utility
+#endif
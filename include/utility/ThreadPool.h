@@ -0,0 +1,66 @@
+#ifndef UTILITY_THREADPOOL_H
+#define UTILITY_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace bricks::utility {
+
+// Runs tasks on a fixed number of threads. Every thread has its own queue and
+// takes tasks from the front of it. A thread whose queue is empty steals from
+// the back of the queues of the others, so long running tasks don't keep
+// the tasks queued behind them waiting.
+class ThreadPool {
+public:
+    explicit ThreadPool(
+        std::size_t threadCount = std::thread::hardware_concurrency());
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    void submit(std::function<void()> task);
+
+    // Blocks until all submitted tasks are finished. Rethrows the first
+    // exception a task threw since the last call.
+    void wait();
+
+    std::size_t threadCount() const;
+
+private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void work(std::size_t queueIndex);
+    bool popOwn(std::size_t queueIndex, std::function<void()>& task);
+    bool steal(std::size_t queueIndex, std::function<void()>& task);
+    void finish(std::exception_ptr exception);
+
+    std::vector<std::unique_ptr<Queue>> mQueues;
+    std::vector<std::thread> mThreads;
+
+    std::mutex mMutex;
+    std::condition_variable mTaskQueued;
+    std::condition_variable mAllFinished;
+    std::atomic<std::size_t> mQueuedCount{0};
+    std::size_t mUnfinishedCount{0};
+    std::size_t mNextQueue{0};
+    bool mStop{false};
+    std::exception_ptr mException;
+};
+
+} // namespace bricks::utility
+
+#endif
@@ -10,6 +10,6 @@ double getElapsedTime(
     const std::chrono::time_point<std::chrono::high_resolution_clock>& first,
     const std::chrono::time_point<std::chrono::high_resolution_clock>& last);
 
-void wait(const std::chrono::milliseconds& milliseconds);
+void wait(const std::chrono::duration<double, std::milli>& milliseconds);
 } // namespace bricks::utility
 #endif
\ No newline at end of file
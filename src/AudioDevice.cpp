@@ -2,6 +2,7 @@
 
 #include "SDL_RAII.h"
 
+#include <array>
 #include <iostream>
 
 namespace bricks {
@@ -15,77 +16,135 @@ constexpr auto filenameLostBall = "sounds/lostBall.wav";
 constexpr auto filenameExtraLife = "sounds/extraLife.wav";
 constexpr auto filenameWinGame = "sounds/winGame.wav";
 
+constexpr int mixerChannels{16};
+
+constexpr std::array<const char*, soundCount> soundFilenames{
+    filenameDestroyBrick, filenameHitBrick,  filenameHitPlatform,
+    filenameGameOver,     filenameNextLevel, filenameLostBall,
+    filenameExtraLife,    filenameWinGame};
+
 AudioDevice::AudioDevice(int rate, Uint16 format, int channels, int buffers)
-    : mRate{rate}, mFormat{format}, mChannels{channels}, mBuffers{buffers},
-      mChunk{nullptr}
+    : mRate{rate}, mFormat{format}, mChannels{channels}, mBuffers{buffers}
 {
     SDL_RAII::init();
 
-    Mix_AllocateChannels(1);
+    if (Mix_OpenAudio(mRate, mFormat, mChannels, mBuffers) != 0) {
+        std::cerr << "Mix_OpenAudio failed: " << Mix_GetError() << '\n';
+    }
+    Mix_AllocateChannels(mixerChannels);
+
+    loadSounds();
+
+    mAudioThread = std::thread{&AudioDevice::playQueuedSounds, this};
 }
 
 AudioDevice::~AudioDevice() noexcept
 {
-    Mix_FreeChunk(mChunk);
+    {
+        std::lock_guard<std::mutex> lock{mMutex};
+        mStop = true;
+    }
+    mSoundQueued.notify_one();
+    mAudioThread.join();
+
+    for (auto& chunk : mChunks) {
+        chunk.reset();
+    }
     Mix_CloseAudio();
 }
 
-void AudioDevice::playSound(const std::string& filename)
+void AudioDevice::playSound(Sound sound)
 {
-    if (Mix_OpenAudio(mRate, mFormat, mChannels, mBuffers) != 0) {
-        std::cerr << "Mix_OpenAudio failed: " << Mix_GetError() << '\n';
+    if (!mQueue.push(sound)) {
+        return;
     }
-
-    mChunk = Mix_LoadWAV(filename.c_str());
-    if (mChunk == NULL) {
-        std::cerr << "Mix_LoadWAV failed: " << Mix_GetError() << '\n';
+    // Taking the lock once orders the push before the wait of the audio
+    // thread checks the queue, so the notification can't get lost.
+    {
+        std::lock_guard<std::mutex> lock{mMutex};
     }
+    mSoundQueued.notify_one();
+}
 
-    Mix_VolumeChunk(mChunk, MIX_MAX_VOLUME);
+void AudioDevice::loadSounds()
+{
+    for (std::size_t i = 0; i < soundCount; ++i) {
+        mChunks[i].reset(Mix_LoadWAV(soundFilenames[i]));
+        if (mChunks[i] == nullptr) {
+            std::cerr << "Mix_LoadWAV failed: " << Mix_GetError() << '\n';
+            continue;
+        }
+        Mix_VolumeChunk(mChunks[i].get(), MIX_MAX_VOLUME);
+    }
+}
 
-    if (Mix_PlayChannel(-1, mChunk, 0) == -1) {
-        std::cerr << "Mix_PlayChannel failed: " << Mix_GetError() << '\n';
+void AudioDevice::playQueuedSounds()
+{
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock{mMutex};
+            mSoundQueued.wait(lock,
+                              [this]() { return mStop || !mQueue.empty(); });
+            if (mStop) {
+                return;
+            }
+        }
+        while (auto sound = mQueue.pop()) {
+            const auto& chunk = mChunks[static_cast<std::size_t>(*sound)];
+            if (chunk == nullptr) {
+                continue;
+            }
+            if (Mix_PlayChannel(-1, chunk.get(), 0) == -1) {
+                std::cerr << "Mix_PlayChannel failed: " << Mix_GetError()
+                          << '\n';
+            }
+        }
     }
 }
 
+void play(AudioDevice& audioDevice, Sound sound)
+{
+    audioDevice.playSound(sound);
+}
+
 void playDestroyBrick(AudioDevice& audioDevice)
 {
-    audioDevice.playSound(filenameDestroyBrick);
+    audioDevice.playSound(Sound::destroyBrick);
 }
 
 void playHitBrick(AudioDevice& audioDevice)
 {
-    audioDevice.playSound(filenameHitBrick);
+    audioDevice.playSound(Sound::hitBrick);
 }
 
 void playHitPlatform(AudioDevice& audioDevice)
 {
-    audioDevice.playSound(filenameHitPlatform);
+    audioDevice.playSound(Sound::hitPlatform);
 }
 
 void playGameOver(AudioDevice& audioDevice)
 {
-    audioDevice.playSound(filenameGameOver);
+    audioDevice.playSound(Sound::gameOver);
 }
 
 void playNextLevel(AudioDevice& audioDevice)
 {
-    audioDevice.playSound(filenameNextLevel);
+    audioDevice.playSound(Sound::nextLevel);
 }
 
 void playLostBall(AudioDevice& audioDevice)
 {
-    audioDevice.playSound(filenameLostBall);
+    audioDevice.playSound(Sound::lostBall);
 }
 
 void playExtraLife(AudioDevice& audioDevice)
 {
-    audioDevice.playSound(filenameExtraLife);
+    audioDevice.playSound(Sound::extraLife);
 }
 
 void playWinGame(AudioDevice& audioDevice)
 {
-    audioDevice.playSound(filenameWinGame);
+    audioDevice.playSound(Sound::winGame);
 }
 
 } // namespace bricks
\ No newline at end of file
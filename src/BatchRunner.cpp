@@ -0,0 +1,112 @@
+#include "BatchRunner.h"
+
+#include "Headless.h"
+#include "LevelCache.h"
+#include "Simulation.h"
+
+#include "utility/ThreadPool.h"
+
+namespace bricks {
+
+using ThreadPool = utility::ThreadPool;
+
+BatchResult runBatch(const std::vector<std::string>& levelFilenames,
+                     const std::vector<BatchJob>& jobs,
+                     const BatchSettings& settings, ThreadPool& pool)
+{
+    auto levels = std::make_shared<LevelCache>(levelFilenames);
+
+    // Every job writes only its own result, so no locking is needed
+    std::vector<BatchResult> results(jobs.size());
+    for (std::size_t i = 0; i < jobs.size(); ++i) {
+        pool.submit([&levels, &jobs, &settings, &results, i]() {
+            results[i] = runBatchJob(levels, jobs[i], settings);
+        });
+    }
+    pool.wait();
+
+    BatchResult result;
+    for (const auto& jobResult : results) {
+        merge(result, jobResult);
+    }
+    return result;
+}
+
+BatchResult runBatchJob(const std::vector<std::string>& levelFilenames,
+                        const BatchJob& job, const BatchSettings& settings)
+{
+    return runBatchJob(std::make_shared<LevelCache>(levelFilenames), job,
+                       settings);
+}
+
+BatchResult runBatchJob(const std::shared_ptr<LevelCache>& levels,
+                        const BatchJob& job, const BatchSettings& settings)
+{
+    BatchResult result;
+    result.games = 1;
+
+    auto levelStatistics = [&result](int level) -> LevelStatistics& {
+        auto idx = static_cast<std::size_t>(level - 1);
+        if (idx >= result.levels.size()) {
+            result.levels.resize(idx + 1);
+        }
+        return result.levels[idx];
+    };
+
+    Simulation simulation{levels, 0, job.difficultyParameters};
+    auto input = makeSloppyFollowBall(job.seed, settings.missProbability);
+
+    auto level = simulation.currentLevel();
+    auto playthroughs = simulation.playthroughs();
+    auto lifes = simulation.lifes();
+    auto score = simulation.score();
+    ++levelStatistics(level).starts;
+
+    auto onTick = [&](const Simulation& current) {
+        auto& statistics = levelStatistics(level);
+        ++statistics.ticks;
+        statistics.score += current.score() - score;
+        if (current.lifes() < lifes) {
+            ++statistics.lostBalls;
+        }
+        if (current.currentLevel() != level ||
+            current.playthroughs() != playthroughs) {
+            ++statistics.completions;
+            ++levelStatistics(current.currentLevel()).starts;
+        }
+
+        level = current.currentLevel();
+        playthroughs = current.playthroughs();
+        lifes = current.lifes();
+        score = current.score();
+    };
+
+    auto headlessResult = runHeadless(simulation, input, settings.maxTicks,
+                                      settings.tickMS, onTick);
+
+    result.ticks = headlessResult.ticks;
+    result.gameOvers = headlessResult.gameOver ? 1 : 0;
+    return result;
+}
+
+void merge(BatchResult& result, const BatchResult& other)
+{
+    result.games += other.games;
+    result.gameOvers += other.gameOvers;
+    result.ticks += other.ticks;
+
+    if (other.levels.size() > result.levels.size()) {
+        result.levels.resize(other.levels.size());
+    }
+    for (std::size_t i = 0; i < other.levels.size(); ++i) {
+        auto& level = result.levels[i];
+        const auto& otherLevel = other.levels[i];
+        level.starts += otherLevel.starts;
+        level.completions += otherLevel.completions;
+        level.ticks += otherLevel.ticks;
+        level.lostBalls += otherLevel.lostBalls;
+        level.score += otherLevel.score;
+    }
+}
+
+} // namespace bricks
@@ -0,0 +1,43 @@
+#include "DirtyRegions.h"
+
+namespace bricks {
+
+void DirtyRegions::add(const ScreenRect& rect)
+{
+    if (rect.w <= 0 || rect.h <= 0) {
+        return;
+    }
+
+    auto merged = rect;
+    // A merged rect can overlap rects it did not overlap before, so search
+    // again until nothing overlaps anymore.
+    auto it = mRects.begin();
+    while (it != mRects.end()) {
+        if (overlaps(merged, *it)) {
+            merged = unite(merged, *it);
+            mRects.erase(it);
+            it = mRects.begin();
+        }
+        else {
+            ++it;
+        }
+    }
+    mRects.push_back(merged);
+}
+
+void DirtyRegions::clear()
+{
+    mRects.clear();
+}
+
+bool DirtyRegions::empty() const
+{
+    return mRects.empty();
+}
+
+const std::vector<ScreenRect>& DirtyRegions::rects() const
+{
+    return mRects;
+}
+
+} // namespace bricks
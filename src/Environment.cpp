@@ -0,0 +1,224 @@
+#include "Environment.h"
+
+#include "LevelCache.h"
+
+#include "utility/ThreadPool.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace bricks {
+
+using Event = InputHandler::Event;
+
+Environment::Environment(std::shared_ptr<LevelCache> levels,
+                         const DifficultyParameters& difficultyParameters,
+                         double tickMS)
+    : Environment{levels, levels->maxBrickCount(), difficultyParameters,
+                  tickMS}
+{
+}
+
+Environment::Environment(std::shared_ptr<LevelCache> levels,
+                         std::size_t maxBrickCount,
+                         const DifficultyParameters& difficultyParameters,
+                         double tickMS)
+    : mSimulation{std::move(levels), 0, difficultyParameters},
+      mTickMS{tickMS}, mMaxBrickCount{maxBrickCount}
+{
+}
+
+void Environment::reset(std::uint64_t seed)
+{
+    mSimulation.restart(seed);
+}
+
+bool Environment::startTick(Action action)
+{
+    if (mSimulation.isGameOver()) {
+        return false;
+    }
+    return mSimulation.startStep(impl::toEvent(action), mTickMS);
+}
+
+void Environment::finishTick(const types::Point& ballEnd)
+{
+    mSimulation.finishStep(mTickMS, ballEnd);
+}
+
+StepResult Environment::step(Action action, int ticks)
+{
+    auto score = mSimulation.score();
+    auto event = impl::toEvent(action);
+    for (int tick = 0; tick < ticks && !mSimulation.isGameOver(); ++tick) {
+        mSimulation.step(event, mTickMS);
+    }
+    return StepResult{mSimulation.score() - score, mSimulation.isGameOver(),
+                      mSimulation.lifes()};
+}
+
+std::size_t Environment::observationSize() const
+{
+    return observationHeaderSize + mMaxBrickCount;
+}
+
+void Environment::observe(float* observation, std::size_t size) const
+{
+    assert(size >= observationSize());
+    (void)size;
+
+    const auto& level = mSimulation.level();
+    const auto& ball = level.ball;
+    const auto& platform = level.platform;
+
+    *observation++ = static_cast<float>(ball.topLeft().x);
+    *observation++ = static_cast<float>(ball.topLeft().y);
+    *observation++ = static_cast<float>(ball.angle().get());
+    *observation++ = static_cast<float>(ball.velocity());
+    *observation++ = ball.isActive() ? 1.0F : 0.0F;
+    *observation++ = static_cast<float>(platform.topLeft().x);
+    *observation++ = static_cast<float>(platform.topLeft().y);
+    *observation++ = static_cast<float>(platform.width());
+    *observation++ = static_cast<float>(level.gridWidth());
+    *observation++ = static_cast<float>(level.gridHeight());
+
+    observation = std::transform(
+        level.bricks.begin(), level.bricks.end(), observation,
+        [](const auto& brick) { return static_cast<float>(brick.hitpoints()); });
+    std::fill_n(observation, mMaxBrickCount - level.bricks.size(), 0.0F);
+}
+
+const Simulation& Environment::simulation() const
+{
+    return mSimulation;
+}
+
+VectorEnvironment::VectorEnvironment(
+    std::shared_ptr<LevelCache> levels, std::size_t count,
+    const DifficultyParameters& difficultyParameters, double tickMS,
+    utility::ThreadPool* pool)
+    : mStartScores(count), mBallMoves(count), mPool{pool}, mTickMS{tickMS}
+{
+    auto maxBrickCount = levels->maxBrickCount();
+    mEnvironments.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        mEnvironments.push_back(std::make_unique<Environment>(
+            levels, maxBrickCount, difficultyParameters, tickMS));
+        mBalls.add(mEnvironments.back()->simulation().level().ball);
+    }
+}
+
+std::size_t VectorEnvironment::size() const
+{
+    return mEnvironments.size();
+}
+
+const Environment& VectorEnvironment::operator[](std::size_t index) const
+{
+    return *mEnvironments[index];
+}
+
+void VectorEnvironment::reset(const std::vector<std::uint64_t>& seeds)
+{
+    assert(seeds.size() == mEnvironments.size());
+    for (std::size_t i = 0; i < mEnvironments.size(); ++i) {
+        mEnvironments[i]->reset(seeds[i]);
+    }
+}
+
+void VectorEnvironment::step(const std::vector<Action>& actions, int ticks,
+                             std::vector<StepResult>& results)
+{
+    assert(actions.size() == mEnvironments.size());
+    results.resize(mEnvironments.size());
+
+    if (mPool == nullptr) {
+        stepRange(actions, ticks, results, 0, mEnvironments.size());
+        return;
+    }
+
+    // One contiguous range per thread, every range writes only its own
+    // results
+    auto threadCount = mPool->threadCount();
+    auto chunkSize = (mEnvironments.size() + threadCount - 1) / threadCount;
+    for (std::size_t first = 0; first < mEnvironments.size();
+         first += chunkSize) {
+        auto last = std::min(first + chunkSize, mEnvironments.size());
+        mPool->submit([this, &actions, ticks, &results, first, last]() {
+            stepRange(actions, ticks, results, first, last);
+        });
+    }
+    mPool->wait();
+}
+
+void VectorEnvironment::stepRange(const std::vector<Action>& actions,
+                                  int ticks, std::vector<StepResult>& results,
+                                  std::size_t first, std::size_t last)
+{
+    for (auto i = first; i < last; ++i) {
+        mStartScores[i] = mEnvironments[i]->simulation().score();
+    }
+
+    for (int tick = 0; tick < ticks; ++tick) {
+        for (auto i = first; i < last; ++i) {
+            auto& environment = *mEnvironments[i];
+            mBallMoves[i] = environment.startTick(actions[i]) ? 1 : 0;
+            if (mBallMoves[i] != 0) {
+                mBalls.set(i, environment.simulation().level().ball);
+            }
+        }
+        // The balls which do not move are moved too, they are set again
+        // before they are used
+        mBalls.move(mTickMS, first, last);
+        for (auto i = first; i < last; ++i) {
+            if (mBallMoves[i] != 0) {
+                mEnvironments[i]->finishTick(mBalls.topLeft(i));
+            }
+        }
+    }
+
+    for (auto i = first; i < last; ++i) {
+        const auto& simulation = mEnvironments[i]->simulation();
+        results[i] = StepResult{simulation.score() - mStartScores[i],
+                                simulation.isGameOver(), simulation.lifes()};
+    }
+}
+
+std::size_t VectorEnvironment::observationSize() const
+{
+    return mEnvironments.empty() ? 0 : mEnvironments.front()->observationSize();
+}
+
+void VectorEnvironment::observe(float* observations, std::size_t size) const
+{
+    auto observationSize = this->observationSize();
+    assert(size >= mEnvironments.size() * observationSize);
+    (void)size;
+
+    for (const auto& environment : mEnvironments) {
+        environment->observe(observations, observationSize);
+        observations += observationSize;
+    }
+}
+
+namespace impl {
+
+Event toEvent(Action action)
+{
+    switch (action) {
+    case Action::left:
+        return Event::left;
+    case Action::right:
+        return Event::right;
+    case Action::launch:
+        return Event::space;
+    case Action::none:
+        break;
+    }
+    return Event::none;
+}
+
+} // namespace impl
+
+} // namespace bricks
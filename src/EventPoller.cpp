@@ -0,0 +1,44 @@
+#include "EventPoller.h"
+
+#include "SDL_RAII.h"
+
+#include <SDL.h>
+
+namespace bricks {
+
+InputHandler::Event pollEvent()
+{
+    using Event = InputHandler::Event;
+
+    SDL_RAII::init();
+
+    SDL_Event sdlEvent;
+    while (SDL_PollEvent(&sdlEvent) != 0) {
+        if (sdlEvent.type == SDL_QUIT) {
+            return Event::quit;
+        }
+        if (sdlEvent.type == SDL_KEYDOWN) {
+            if (sdlEvent.key.keysym.sym == SDLK_p) {
+                return Event::p;
+            }
+        }
+    }
+
+    const Uint8* keystates = SDL_GetKeyboardState(NULL);
+
+    if (keystates[SDL_SCANCODE_LEFT] != 0U) {
+        return Event::left;
+    }
+    if (keystates[SDL_SCANCODE_RIGHT] != 0U) {
+        return Event::right;
+    }
+    if (keystates[SDL_SCANCODE_SPACE] != 0U) {
+        return Event::space;
+    }
+    if (keystates[SDL_SCANCODE_ESCAPE] != 0U) {
+        return Event::escape;
+    }
+    return Event::none;
+}
+
+} // namespace bricks
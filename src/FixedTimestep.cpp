@@ -0,0 +1,50 @@
+#include "FixedTimestep.h"
+
+#include "types/Point.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace bricks {
+
+using Point = types::Point;
+
+FixedTimestep::FixedTimestep(double tickMS, double maxFrameMS)
+    : mTickMS{tickMS}, mMaxFrameMS{maxFrameMS}
+{
+    if (mTickMS <= 0.0 || mMaxFrameMS < mTickMS) {
+        throw std::invalid_argument(
+            "FixedTimestep::FixedTimestep(double tickMS, double maxFrameMS)\n"
+            "tickMS must be > 0 and maxFrameMS >= tickMS\n");
+    }
+}
+
+int FixedTimestep::advance(double elapsedTimeMS)
+{
+    mAccumulatorMS += std::clamp(elapsedTimeMS, 0.0, mMaxFrameMS);
+
+    int ticks{0};
+    while (mAccumulatorMS >= mTickMS) {
+        mAccumulatorMS -= mTickMS;
+        ++ticks;
+    }
+    return ticks;
+}
+
+double FixedTimestep::tickMS() const
+{
+    return mTickMS;
+}
+
+double FixedTimestep::alpha() const
+{
+    return mAccumulatorMS / mTickMS;
+}
+
+Point interpolate(const Point& previous, const Point& current, double alpha)
+{
+    return Point{previous.x + (current.x - previous.x) * alpha,
+                 previous.y + (current.y - previous.y) * alpha};
+}
+
+} // namespace bricks
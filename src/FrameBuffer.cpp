@@ -0,0 +1,152 @@
+#include "FrameBuffer.h"
+
+#include "types/RGBColor.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace bricks {
+
+using RGBColor = types::RGBColor;
+
+FrameBuffer::FrameBuffer(int width, int height)
+    : mWidth{width}, mHeight{height}
+{
+    if (mWidth <= 0 || mHeight <= 0) {
+        throw std::invalid_argument(
+            "FrameBuffer::FrameBuffer(int width, int height)\n"
+            "width and height must be > 0\n");
+    }
+    mPixels.resize(static_cast<std::size_t>(mWidth) *
+                   static_cast<std::size_t>(mHeight));
+}
+
+int FrameBuffer::width() const
+{
+    return mWidth;
+}
+
+int FrameBuffer::height() const
+{
+    return mHeight;
+}
+
+void FrameBuffer::clear(std::uint32_t pixel)
+{
+    impl::fillSpan(mPixels.data(), mPixels.size(), pixel);
+}
+
+void FrameBuffer::fillRect(const ScreenRect& rect, std::uint32_t pixel)
+{
+    auto left = std::max(rect.x, 0);
+    auto top = std::max(rect.y, 0);
+    auto right = std::min(rect.x + rect.w, mWidth);
+    auto bottom = std::min(rect.y + rect.h, mHeight);
+    if (left >= right || top >= bottom) {
+        return;
+    }
+
+    auto count = static_cast<std::size_t>(right - left);
+    for (auto y = top; y < bottom; ++y) {
+        impl::fillSpan(&mPixels[static_cast<std::size_t>(y) * mWidth + left],
+                       count, pixel);
+    }
+}
+
+std::uint32_t FrameBuffer::pixel(int x, int y) const
+{
+    if (x < 0 || x >= mWidth || y < 0 || y >= mHeight) {
+        throw std::out_of_range(
+            "std::uint32_t FrameBuffer::pixel(int x, int y) const\n"
+            "x or y is outside of the frame buffer\n");
+    }
+    return mPixels[static_cast<std::size_t>(y) * mWidth + x];
+}
+
+const std::vector<std::uint32_t>& FrameBuffer::pixels() const
+{
+    return mPixels;
+}
+
+std::uint32_t toPixel(const RGBColor& color)
+{
+    std::array<std::uint8_t, 4> bytes{static_cast<std::uint8_t>(color.r()),
+                                      static_cast<std::uint8_t>(color.g()),
+                                      static_cast<std::uint8_t>(color.b()),
+                                      static_cast<std::uint8_t>(color.a())};
+    std::uint32_t pixel{0};
+    std::memcpy(&pixel, bytes.data(), bytes.size());
+    return pixel;
+}
+
+RGBColor toRGBColor(std::uint32_t pixel)
+{
+    std::array<std::uint8_t, 4> bytes{};
+    std::memcpy(bytes.data(), &pixel, bytes.size());
+    return RGBColor{bytes[0], bytes[1], bytes[2], bytes[3]};
+}
+
+void writePPM(std::ostream& os, const FrameBuffer& frameBuffer)
+{
+    os << "P6\n"
+       << frameBuffer.width() << ' ' << frameBuffer.height() << "\n255\n";
+
+    const auto& pixels = frameBuffer.pixels();
+    std::vector<char> row(static_cast<std::size_t>(frameBuffer.width()) * 3);
+    for (std::size_t first = 0; first < pixels.size();
+         first += static_cast<std::size_t>(frameBuffer.width())) {
+        for (std::size_t x = 0; x < row.size() / 3; ++x) {
+            std::memcpy(&row[x * 3], &pixels[first + x], 3);
+        }
+        os.write(row.data(), static_cast<std::streamsize>(row.size()));
+    }
+}
+
+void writeRaw(std::ostream& os, const FrameBuffer& frameBuffer)
+{
+    const auto& pixels = frameBuffer.pixels();
+    os.write(reinterpret_cast<const char*>(pixels.data()),
+             static_cast<std::streamsize>(pixels.size() * sizeof(pixels[0])));
+}
+
+namespace impl {
+
+void fillSpan(std::uint32_t* first, std::size_t count, std::uint32_t pixel)
+{
+    std::size_t i = 0;
+
+#if defined(__AVX__)
+    auto pixels = _mm256_set1_epi32(static_cast<int>(pixel));
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(first + i), pixels);
+    }
+#elif defined(__SSE2__)
+    auto pixels = _mm_set1_epi32(static_cast<int>(pixel));
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(first + i), pixels);
+    }
+#endif
+
+    fillSpanScalar(first + i, count - i, pixel);
+}
+
+void fillSpanScalar(std::uint32_t* first, std::size_t count,
+                    std::uint32_t pixel)
+{
+    for (std::size_t i = 0; i < count; ++i) {
+        first[i] = pixel;
+    }
+}
+
+} // namespace impl
+
+} // namespace bricks
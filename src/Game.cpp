@@ -1,225 +1,153 @@
 #include "Game.h"
 
-#include "game_objects/Physics.h"
+#include "EventPoller.h"
 
 #include "utility/IsNumber.h"
 #include "utility/TimeMeasure.h"
 
-#include <algorithm>
-#include <cassert>
-#include <filesystem>
 #include <fstream>
+#include <random>
 #include <string>
+#include <utility>
 
 namespace bricks {
 
 using namespace utility;
 
-using Ball = game_objects::Ball;
-using Brick = game_objects::Brick;
-using GameObject = game_objects::GameObject;
-using IndestructibleBrick = game_objects::IndestructibleBrick;
-using Platform = game_objects::Platform;
-using Wall = game_objects::Wall;
-
-using Width = types::Width;
-using Velocity = types::Velocity;
-using Gravity = types::Gravity;
-
-constexpr std::size_t framesPerSecond{60};
-constexpr std::size_t msPerFrame{1000 / framesPerSecond};
-
-constexpr int pointsPerBrickHitpoints{100};
-constexpr int pointsForExtraLife{10000};
-
 constexpr auto highscoreFilename = "highscore.dat";
 
-constexpr double ballVelocityIncrease = 2.0;
-constexpr double ballGravityIncrease = 0.5;
-constexpr double platformVelocityIncrease = 2.0;
-constexpr double platformWidthDecrease = 0.5;
-
-constexpr double ballVelocityMax = 30.0;
-constexpr double ballGravityMax = 5.0;
-constexpr double platformVelocityMax = 28.0;
-constexpr double platformWidthMin = 2.0;
-
-Game::Game(std::size_t screenWidth, std::size_t screenHeight)
-    : mLevelFilenames{getLevelFilenamesFromFolder("level")},
-      mLevel{loadLevel(mLevelFilenames, 1)},
-      mRenderer{Renderer{screenWidth, screenHeight,
-                         static_cast<std::size_t>(mLevel.gridWidth()),
-                         static_cast<std::size_t>(mLevel.gridHeight())}},
-      mHighscore{loadHighscore()}
-{
-    mLevel.setDifficultyParameters(mDifficultyParameters);
+Game::Game(std::size_t screenWidth, std::size_t screenHeight,
+           double ticksPerSecond, double maxFramesPerSecond,
+           RenderMode renderMode, bool vsync, std::string recordFilename,
+           double platformDeviation)
+    : mReplay{platformDeviation > 0.0 ? makeSeed() : 0, platformDeviation},
+      mRecordFilename{std::move(recordFilename)},
+      mSimulation{getLevelFilenamesFromFolder("level"), loadHighscore(),
+                  mReplay.difficultyParameters, mReplay.seed,
+                  mReplay.platformDeviation},
+      mRenderer{Renderer{
+          screenWidth, screenHeight,
+          static_cast<std::size_t>(mSimulation.level().gridWidth()),
+          static_cast<std::size_t>(mSimulation.level().gridHeight()),
+          renderMode, vsync}},
+      mTimestep{1000.0 / ticksPerSecond},
+      mMSPerFrame{1000.0 / maxFramesPerSecond},
+      mHighscore{mSimulation.highscore()}
+{
+    mReplay.tickMS = mTimestep.tickMS();
+    rememberPositions();
     updateValuesInTitleBar();
 }
 
 void Game::run()
 {
+    auto lastFrame = getCurrentTime();
+
     while (true) {
-        runLevel();
-        if (mInputHandler.isQuit()) {
-            return;
-        }
-        if (mGameOver) {
-            playGameOver(mAudioDevice);
-            if (mScore > mHighscore) {
-                mHighscore = mScore;
-                saveHighscore(mHighscore);
+        auto frameStart = getCurrentTime();
+        auto ticks = mTimestep.advance(getElapsedTime(lastFrame, frameStart));
+        lastFrame = frameStart;
+
+        for (int i = 0; i < ticks; ++i) {
+            if (!tick()) {
+                return;
             }
-            mCurrentLevelIDX = 1;
-            mLifes = mStartLifes;
-            mGameOver = false;
-            mScore = 0;
-            mDifficultyParameters = DifficultyParameters{};
-        }
-        else if (allLevelsFinished()) {
-            playWinGame(mAudioDevice);
-            mCurrentLevelIDX = 1;
-            increaseDifficulty();
-        }
-        else {
-            playNextLevel(mAudioDevice);
-            ++mCurrentLevelIDX;
         }
-        mLevel = loadLevel(mLevelFilenames, mCurrentLevelIDX);
-        mLevel.setDifficultyParameters(mDifficultyParameters);
+        render();
 
-        updateValuesInTitleBar();
+        delayToFramerate(getElapsedTime(frameStart, getCurrentTime()),
+                         mMSPerFrame);
     }
 }
 
-void Game::runLevel()
+bool Game::tick()
 {
-    std::chrono::time_point<std::chrono::high_resolution_clock> timepoint1;
-    std::chrono::time_point<std::chrono::high_resolution_clock> timepoint2;
-
-    while (true) {
-        timepoint1 = getCurrentTime();
-
-        mRenderer.render(mLevel);
+    rememberPositions();
+    auto lifes = mSimulation.lifes();
+    auto level = mSimulation.currentLevel();
+    auto playthroughs = mSimulation.playthroughs();
 
-        mInputHandler.handleInput(mLevel, msPerFrame);
-        if (mInputHandler.changedPauseState()) {
-            mRenderer.setPaused(mInputHandler.isPaused());
-        }
-        if (mInputHandler.isQuit()) {
-            return;
-        }
-        if (mInputHandler.isPaused()) {
-            continue;
-        }
-
-        if (mLevel.ball.isActive()) {
-            mLevel.ball.move(msPerFrame);
-
-            if (ballIsLost()) {
-                --mLifes;
-                if (mLifes <= 0) {
-                    mGameOver = true;
-                    return;
-                }
-                playLostBall(mAudioDevice);
-
-                updateValuesInTitleBar();
-                mLevel.resetBall();
-                mLevel.resetPlatform();
-            }
-
-            handleBallCollisions();
-            if (allBricksAreDestroyed(mLevel.bricks)) {
-                break;
-            }
-        }
-
-        timepoint2 = getCurrentTime();
+    auto event = pollEvent();
+    if (!mRecordFilename.empty()) {
+        mReplay.events.push_back(event);
+    }
 
-        delayToFramerate(getElapsedTime(timepoint1, timepoint2));
+    mSimulation.step(event, mTimestep.tickMS());
+    mRenderer.invalidateBricks(mSimulation.hitBricks());
+    if (mSimulation.changedPauseState()) {
+        mRenderer.setPaused(mSimulation.isPaused());
+    }
+    if (mSimulation.isQuit()) {
+        saveReplayIfRecording();
+        return false;
     }
-}
 
-bool Game::allLevelsFinished()
-{
-    return mCurrentLevelIDX >= mLevelFilenames.size();
+    playSounds();
+    if (mSimulation.isGameOver()) {
+        saveHighscoreIfBeaten();
+        mSimulation.restart();
+        mRenderer.invalidateLayers();
+    }
+    // A game with one level resets it in place after it was finished
+    auto levelChanged = mSimulation.currentLevel() != level ||
+                        mSimulation.playthroughs() != playthroughs;
+    if (levelChanged) {
+        mRenderer.invalidateLayers();
+    }
+    if (mSimulation.statusChanged()) {
+        updateValuesInTitleBar();
+    }
+    // Ball and platform were placed anew, don't interpolate from the old spot
+    if (mSimulation.lifes() != lifes || levelChanged) {
+        rememberPositions();
+    }
+    return true;
 }
 
-void Game::increaseDifficulty()
+void Game::render()
 {
-    double platformVelocity = mDifficultyParameters.getPlatformVelocity()();
-    double platformWidth = mDifficultyParameters.getPlatformWidth()();
-    double ballVelocity = mDifficultyParameters.getBallVelocity()();
-    double ballGravity = mDifficultyParameters.getBallGravity()();
-
-    platformVelocity = std::clamp(platformVelocity + platformVelocityIncrease,
-                                  platformVelocity, platformVelocityMax);
-    platformWidth = std::clamp(platformWidth - platformWidthDecrease,
-                               platformWidthMin, platformWidth);
-    ballVelocity = std::clamp(ballVelocity + ballVelocityIncrease, ballVelocity,
-                              ballVelocityMax);
-    ballGravity = std::clamp(ballGravity + ballGravityIncrease, ballGravity,
-                             ballGravityMax);
+    const auto& level = mSimulation.level();
+    auto alpha = mTimestep.alpha();
 
-    mDifficultyParameters.setPlatformVelocity(Velocity{platformVelocity});
-    mDifficultyParameters.setPlatformWidth(Width{platformWidth});
-    mDifficultyParameters.setBallVelocity(Velocity{ballVelocity});
-    mDifficultyParameters.setBallGravity(Gravity{ballGravity});
+    mRenderer.render(
+        level, interpolate(mPreviousBallTopLeft, level.ball.topLeft(), alpha),
+        interpolate(mPreviousPlatformTopLeft, level.platform.topLeft(),
+                    alpha));
 }
 
-void Game::updateValuesInTitleBar()
+void Game::rememberPositions()
 {
-    mRenderer.setWindowTitle(
-        makeTitle(mCurrentLevelIDX, mLifes, mScore, mHighscore));
+    mPreviousBallTopLeft = mSimulation.level().ball.topLeft();
+    mPreviousPlatformTopLeft = mSimulation.level().platform.topLeft();
 }
 
-bool Game::ballIsLost()
+void Game::playSounds()
 {
-    return mLevel.ball.bottomRight().y >= mLevel.gridHeight();
+    for (const auto& sound : mSimulation.sounds()) {
+        play(mAudioDevice, sound);
+    }
 }
 
-void Game::handleBallCollisions()
+void Game::saveHighscoreIfBeaten()
 {
-    auto hitObjects = game_objects::reflectFromGameObjects(
-        mLevel.ball,
-        std::vector<Wall>{mLevel.leftWall(), mLevel.rightWall(),
-                          mLevel.topWall()},
-        mLevel.indestructibleBricks, mLevel.bricks);
-
-    for (const auto& hitObject : hitObjects) {
-        auto brick = dynamic_cast<Brick*>(hitObject.get());
-        if (!brick) {
-            continue;
-        }
-        if (brick->isDestroyed()) {
-            playDestroyBrick(mAudioDevice);
-            mScore += getBrickScore(*brick);
-            awardExtraLifeIfThresholdReached();
-            updateValuesInTitleBar();
-        }
-        else {
-            playHitBrick(mAudioDevice);
-        }
-    }
-
-    if (game_objects::reflectFromPlatform(mLevel.ball, mLevel.platform)) {
-        playHitPlatform(mAudioDevice);
+    if (mSimulation.highscore() > mHighscore) {
+        mHighscore = mSimulation.highscore();
+        saveHighscore(mHighscore);
     }
 }
 
-long long Game::getBrickScore(const Brick& brick) const
+void Game::saveReplayIfRecording()
 {
-    return pointsPerBrickHitpoints * brick.startHitpoints() * mCurrentLevelIDX;
+    if (!mRecordFilename.empty()) {
+        saveReplay(mRecordFilename, mReplay);
+    }
 }
 
-void Game::awardExtraLifeIfThresholdReached()
+void Game::updateValuesInTitleBar()
 {
-    auto extraLifeDivisor = static_cast<long long>(mScore / pointsForExtraLife);
-    if (extraLifeDivisor != mLastExtraLifeDivisor) {
-        playExtraLife(mAudioDevice);
-        ++mLifes;
-        mLastExtraLifeDivisor = extraLifeDivisor;
-    }
+    mRenderer.setWindowTitle(makeTitle(mSimulation.currentLevel(),
+                                       mSimulation.lifes(), mSimulation.score(),
+                                       mSimulation.highscore()));
 }
 
 long long loadHighscore()
@@ -246,6 +174,12 @@ void saveHighscore(long long highscore)
     ofs << highscore;
 }
 
+std::uint64_t makeSeed()
+{
+    std::random_device device;
+    return (static_cast<std::uint64_t>(device()) << 32U) | device();
+}
+
 std::string makeTitle(int level, int lifes, long long score,
                       long long highscore)
 {
@@ -261,38 +195,12 @@ std::string makeTitle(int level, int lifes, long long score,
                        std::to_string(highscore)};
 }
 
-bool allBricksAreDestroyed(const std::vector<Brick> bricks)
-{
-    return std::find_if(bricks.begin(), bricks.end(), [](const Brick& b) {
-               return !b.isDestroyed();
-           }) == bricks.end();
-}
-
-void delayToFramerate(double elapsedTimeInMS)
+void delayToFramerate(double elapsedTimeInMS, double msPerFrame)
 {
     if (elapsedTimeInMS < msPerFrame) {
-        wait(std::chrono::milliseconds{
-            static_cast<int>(msPerFrame - elapsedTimeInMS)});
+        wait(std::chrono::duration<double, std::milli>{msPerFrame -
+                                                       elapsedTimeInMS});
     }
 }
 
-Level loadLevel(const std::vector<std::string>& levelFilenames, int levelIDX)
-{
-    assert(!levelFilenames.empty());
-
-    return readFromFile(levelFilenames.at(levelIDX - 1));
-}
-
-std::vector<std::string>
-getLevelFilenamesFromFolder(const std::string& folderName)
-{
-    std::vector<std::string> names;
-    for (auto& p : std::filesystem::directory_iterator(folderName)) {
-        if (p.path().extension() == ".lvl") {
-            names.emplace_back(std::filesystem::absolute(p.path()));
-        }
-    }
-    std::sort(names.begin(), names.end());
-    return names;
-}
-} // namespace bricks
\ No newline at end of file
+} // namespace bricks
@@ -0,0 +1,114 @@
+#include "Headless.h"
+
+#include "Level.h"
+#include "Simulation.h"
+#include "SoftwareRenderer.h"
+
+#include "utility/Random.h"
+
+#include <memory>
+
+namespace bricks {
+
+using Event = InputHandler::Event;
+
+HeadlessResult runHeadless(Simulation& simulation, const InputScript& input,
+                           long long maxTicks, double tickMS,
+                           const TickCallback& onTick)
+{
+    HeadlessResult result;
+
+    while (result.ticks < maxTicks) {
+        simulation.step(input(simulation.level()), tickMS);
+        ++result.ticks;
+        if (onTick) {
+            onTick(simulation);
+        }
+
+        if (simulation.isGameOver() || simulation.isQuit()) {
+            break;
+        }
+    }
+
+    result.score = simulation.score();
+    result.level = simulation.currentLevel();
+    result.lifes = simulation.lifes();
+    result.playthroughs = simulation.playthroughs();
+    result.gameOver = simulation.isGameOver();
+    return result;
+}
+
+InputScript makeScriptedInput(std::vector<Event> events)
+{
+    auto script = std::make_shared<std::vector<Event>>(std::move(events));
+    auto position = std::make_shared<std::size_t>(0);
+
+    return [script, position](const Level&) {
+        if (*position >= script->size()) {
+            return Event::none;
+        }
+        return (*script)[(*position)++];
+    };
+}
+
+Event followBall(const Level& level)
+{
+    if (!level.ball.isActive()) {
+        return Event::space;
+    }
+
+    auto ballCenter = level.ball.topLeft().x + level.ball.width() / 2.0;
+    auto platformCenter =
+        level.platform.topLeft().x + level.platform.width() / 2.0;
+    auto tolerance = level.platform.width() / 4.0;
+
+    if (ballCenter < platformCenter - tolerance) {
+        return Event::left;
+    }
+    if (ballCenter > platformCenter + tolerance) {
+        return Event::right;
+    }
+    return Event::none;
+}
+
+InputScript makeSloppyFollowBall(std::uint64_t seed, double missProbability)
+{
+    auto random = std::make_shared<utility::Random>(seed);
+
+    return [random, missProbability](const Level& level) {
+        if (random->chance(missProbability)) {
+            return Event::none;
+        }
+        return followBall(level);
+    };
+}
+
+TickCallback makeFrameCapture(std::ostream& os, FrameFormat format,
+                              std::size_t screenWidth,
+                              std::size_t screenHeight)
+{
+    // Created on the first tick, when the grid size of the level is known.
+    std::shared_ptr<SoftwareRenderer> renderer;
+
+    return [&os, format, screenWidth, screenHeight,
+            renderer](const Simulation& simulation) mutable {
+        const auto& level = simulation.level();
+        if (renderer == nullptr) {
+            renderer = std::make_shared<SoftwareRenderer>(
+                screenWidth, screenHeight,
+                static_cast<std::size_t>(level.gridWidth()),
+                static_cast<std::size_t>(level.gridHeight()));
+        }
+        renderer->setPaused(simulation.isPaused());
+        renderer->render(level);
+
+        if (format == FrameFormat::ppm) {
+            writePPM(os, renderer->frame());
+        }
+        else {
+            writeRaw(os, renderer->frame());
+        }
+    };
+}
+
+} // namespace bricks
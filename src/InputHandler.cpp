@@ -7,9 +7,6 @@
 #include "types/Point.h"
 
 #include "Level.h"
-#include "SDL_RAII.h"
-
-#include <SDL.h>
 
 namespace bricks {
 
@@ -19,17 +16,6 @@ using Wall = game_objects::Wall;
 
 using Point = types::Point;
 
-InputHandler::InputHandler()
-{
-    SDL_RAII::init();
-}
-
-void InputHandler::handleInput(Level& level, double elapsedTimeMS)
-{
-    auto event = getEvent();
-    handleEvent(event, elapsedTimeMS, level);
-}
-
 bool InputHandler::isPaused() const
 {
     return mPaused;
@@ -45,37 +31,6 @@ bool InputHandler::isQuit() const
     return mQuit;
 }
 
-InputHandler::Event InputHandler::getEvent()
-{
-    SDL_Event sdlEvent;
-    while (SDL_PollEvent(&sdlEvent) != 0) {
-        if (sdlEvent.type == SDL_QUIT) {
-            return Event::quit;
-        }
-        if (sdlEvent.type == SDL_KEYDOWN) {
-            if (sdlEvent.key.keysym.sym == SDLK_p) {
-                return Event::p;
-            }
-        }
-    }
-
-    const Uint8* keystates = SDL_GetKeyboardState(NULL);
-
-    if (keystates[SDL_SCANCODE_LEFT] != 0U) {
-        return Event::left;
-    }
-    if (keystates[SDL_SCANCODE_RIGHT] != 0U) {
-        return Event::right;
-    }
-    if (keystates[SDL_SCANCODE_SPACE] != 0U) {
-        return Event::space;
-    }
-    if (keystates[SDL_SCANCODE_ESCAPE] != 0U) {
-        return Event::escape;
-    }
-    return Event::none;
-}
-
 void InputHandler::handleEvent(const InputHandler::Event& event,
                                double elapsedTimeMS, Level& level)
 {
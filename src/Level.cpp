@@ -1,5 +1,7 @@
 #include "Level.h"
 
+#include "LevelParser.h"
+
 #include "types/GridHeight.h"
 #include "types/GridWidth.h"
 #include "types/Height.h"
@@ -7,12 +9,17 @@
 #include "types/Point.h"
 #include "types/Width.h"
 
+#include "utility/MappedFile.h"
 #include "utility/OperatorDegree.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstring>
 #include <fstream>
 #include <iostream>
-#include <sstream>
+#include <iterator>
+#include <string_view>
 
 namespace bricks {
 
@@ -30,6 +37,7 @@ using GridHeight = types::GridHeight;
 
 using Ball = game_objects::Ball;
 using Brick = game_objects::Brick;
+using BrickGrid = game_objects::BrickGrid;
 using GameObject = game_objects::GameObject;
 using IndestructibleBrick = game_objects::IndestructibleBrick;
 using Platform = game_objects::Platform;
@@ -37,6 +45,10 @@ using Wall = game_objects::Wall;
 
 static constexpr auto wallThickness{1.0};
 
+static constexpr char binaryLevelMagic[4] = {'B', 'R', 'K', 'L'};
+static constexpr std::uint32_t binaryLevelVersion{1};
+static constexpr auto binaryLevelExtension = ".blvl";
+
 static constexpr auto platformHeight{0.5};
 
 static constexpr auto ballWidth{0.75};
@@ -45,16 +57,18 @@ static constexpr auto ballAngle{135.0_deg};
 
 Level::Level(const DifficultyParameters& difficultyParameters,
              const GridWidth& gridWidth, const GridHeight& gridHeight,
-             const std::vector<Brick>& bricks_,
-             const std::vector<IndestructibleBrick>& indestructibleBricks_)
+             std::vector<Brick> bricks_,
+             std::vector<IndestructibleBrick> indestructibleBricks_)
     : mDifficultyParameters{difficultyParameters}, mGridWidth{gridWidth()},
       mGridHeight{gridHeight()}, mLeftWall{makeLeftWall()},
       mRightWall{makeRightWall()}, mTopWall{makeTopWall()},
+      mWalls{mLeftWall, mRightWall, mTopWall},
       platform{makePlatform(mDifficultyParameters.getPlatformWidth(),
                             mDifficultyParameters.getPlatformVelocity())},
       ball{makeBall(mDifficultyParameters.getBallVelocity(),
                     mDifficultyParameters.getBallGravity())},
-      bricks{bricks_}, indestructibleBricks{indestructibleBricks_}
+      bricks{std::move(bricks_)},
+      indestructibleBricks{std::move(indestructibleBricks_)}
 {
     assert(mGridWidth > 0);
     assert(mGridHeight > 0);
@@ -70,6 +84,10 @@ Level::Level(const DifficultyParameters& difficultyParameters,
     for (auto& indestructibleBrick : indestructibleBricks) {
         transposeCoordinatesWithWalls(indestructibleBrick);
     }
+    brickGrid = BrickGrid{mGridWidth, mGridHeight, bricks};
+    mAliveBrickCount = static_cast<int>(
+        std::count_if(bricks.begin(), bricks.end(),
+                      [](const Brick& brick) { return !brick.isDestroyed(); }));
 }
 
 int Level::gridWidth() const
@@ -97,6 +115,46 @@ Wall Level::topWall() const
     return mTopWall;
 }
 
+const std::vector<Wall>& Level::walls() const
+{
+    return mWalls;
+}
+
+int Level::aliveBrickCount() const
+{
+    return mAliveBrickCount;
+}
+
+bool Level::allBricksDestroyed() const
+{
+    return mAliveBrickCount == 0;
+}
+
+void Level::reflectBall(std::vector<game_objects::Hit>& hits)
+{
+    game_objects::reflectFromGameObjects(ball, mWalls, indestructibleBricks,
+                                         bricks, brickGrid, hits);
+    for (const auto& hit : hits) {
+        if (hit.kind == game_objects::ObjectKind::brick &&
+            bricks[hit.index].isDestroyed()) {
+            assert(mAliveBrickCount > 0);
+            --mAliveBrickCount;
+        }
+    }
+}
+
+void Level::hitBrick(std::size_t index)
+{
+    auto& brick = bricks[index];
+    assert(!brick.isDestroyed());
+    brick.decreaseHitpoints();
+    brickGrid.update(index, brick);
+    if (brick.isDestroyed()) {
+        assert(mAliveBrickCount > 0);
+        --mAliveBrickCount;
+    }
+}
+
 void Level::setDifficultyParameters(
     const DifficultyParameters& difficultyParameters)
 {
@@ -116,6 +174,17 @@ void Level::resetPlatform()
                             mDifficultyParameters.getPlatformVelocity());
 }
 
+void Level::reset()
+{
+    for (auto& brick : bricks) {
+        brick.resetHitpoints();
+    }
+    brickGrid.reset(bricks);
+    mAliveBrickCount = static_cast<int>(bricks.size());
+    resetBall();
+    resetPlatform();
+}
+
 Wall Level::makeLeftWall() const
 {
     return Wall{Point{0, 0}, Width{wallThickness},
@@ -159,103 +228,159 @@ void Level::transposeCoordinatesWithWalls(GameObject& obj)
 
 Level readFromFile(const std::string& filename)
 {
-    std::ifstream ifs{filename};
-    if (!ifs.is_open()) {
-        throw std::runtime_error("File:" + filename + "could not be opend\n");
-    }
-    Level level;
-    ifs >> level;
+    std::ifstream ifs{filename, std::ios::binary | std::ios::ate};
     if (!ifs) {
-        std::runtime_error("Could not read level from file: " + filename +
-                           "\n");
+        throw std::runtime_error("File:" + filename + " could not be opened\n");
     }
-    return level;
+    std::string text(static_cast<std::size_t>(ifs.tellg()), '\0');
+    ifs.seekg(0);
+    if (!ifs.read(text.data(), static_cast<std::streamsize>(text.size()))) {
+        throw std::runtime_error("File:" + filename + " could not be read\n");
+    }
+    return parseLevel(text, filename);
 }
 
 std::istream& operator>>(std::istream& is, Level& obj)
 {
-    std::string line;
-    std::getline(is, line);
-    std::istringstream ist{line};
-
-    GridWidth gridWidth;
-    ist >> gridWidth;
-    if (!ist) {
-        is.setstate(std::ios_base::failbit);
-        return is;
+    std::string text{std::istreambuf_iterator<char>{is},
+                     std::istreambuf_iterator<char>{}};
+    try {
+        obj = parseLevel(text);
     }
-    GridHeight gridHeight;
-    ist >> gridHeight;
-    if (!ist) {
+    catch (const LevelParseError&) {
         is.setstate(std::ios_base::failbit);
-        return is;
     }
+    return is;
+}
 
-    std::vector<Brick> bricks;
-    std::vector<IndestructibleBrick> indestructibleBricks;
-
-    while (std::getline(is, line)) {
+void writeBinary(std::ostream& os, const Level& level)
+{
+    impl::BinaryLevelHeader header{};
+    std::memcpy(header.magic, binaryLevelMagic, sizeof(header.magic));
+    header.version = binaryLevelVersion;
+    header.gridWidth = static_cast<std::uint32_t>(
+        level.gridWidth() - static_cast<int>(2 * wallThickness));
+    header.gridHeight = static_cast<std::uint32_t>(
+        level.gridHeight() - static_cast<int>(wallThickness));
+    header.brickCount = static_cast<std::uint32_t>(level.bricks.size());
+    header.indestructibleBrickCount =
+        static_cast<std::uint32_t>(level.indestructibleBricks.size());
+    os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    for (const auto& brick : level.bricks) {
+        impl::BinaryBrickRecord record{};
+        record.x = brick.topLeft().x - wallThickness;
+        record.y = brick.topLeft().y - wallThickness;
+        record.width = brick.width();
+        record.height = brick.height();
+        record.hitpoints = brick.startHitpoints();
+        os.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    }
+    for (const auto& brick : level.indestructibleBricks) {
+        impl::BinaryIndestructibleBrickRecord record{};
+        record.x = brick.topLeft().x - wallThickness;
+        record.y = brick.topLeft().y - wallThickness;
+        record.width = brick.width();
+        record.height = brick.height();
+        os.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    }
+}
 
-        if (impl::isComment(line)) {
-            continue;
-        }
+Level readFromBinaryFile(const std::string& filename)
+{
+    MappedFile file{filename};
+    return readFromBinary(file.data(), file.size());
+}
 
-        std::istringstream ist{line};
+Level readFromBinary(const unsigned char* data, std::size_t size)
+{
+    impl::BinaryLevelHeader header{};
+    if (size < sizeof(header)) {
+        throw std::runtime_error(
+            "Level readFromBinary(const unsigned char* data, std::size_t "
+            "size)\nToo small for a binary level\n");
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, binaryLevelMagic, sizeof(header.magic)) !=
+            0 ||
+        header.version != binaryLevelVersion) {
+        throw std::runtime_error(
+            "Level readFromBinary(const unsigned char* data, std::size_t "
+            "size)\nNot a binary level of version " +
+            std::to_string(binaryLevelVersion) + "\n");
+    }
+    auto expectedSize =
+        sizeof(header) +
+        header.brickCount * sizeof(impl::BinaryBrickRecord) +
+        header.indestructibleBrickCount *
+            sizeof(impl::BinaryIndestructibleBrickRecord);
+    if (size != expectedSize) {
+        throw std::runtime_error(
+            "Level readFromBinary(const unsigned char* data, std::size_t "
+            "size)\nSize does not match the brick counts\n");
+    }
 
-        Point point;
-        ist >> point;
-        if (!ist) {
-            is.setstate(std::ios_base::failbit);
-            return is;
-        }
-        if (point.x > gridWidth()) {
-            is.setstate(std::ios_base::failbit);
-            return is;
+    GridWidth gridWidth{static_cast<int>(header.gridWidth)};
+    GridHeight gridHeight{static_cast<int>(header.gridHeight)};
+    // Same checks as the text parser, a record could be corrupted
+    auto checkRecord = [&gridWidth, &gridHeight](const auto& record) {
+        if (!std::isfinite(record.x) || !std::isfinite(record.y) ||
+            !std::isfinite(record.width) || !std::isfinite(record.height)) {
+            throw std::runtime_error(
+                "Level readFromBinary(const unsigned char* data, std::size_t "
+                "size)\nBrick with a position or size which is not finite\n");
         }
-        if (point.y > gridHeight()) {
-            is.setstate(std::ios_base::failbit);
-            return is;
+        if (record.x < 0.0 || record.x > gridWidth() || record.y < 0.0 ||
+            record.y > gridHeight()) {
+            throw std::runtime_error(
+                "Level readFromBinary(const unsigned char* data, std::size_t "
+                "size)\nBrick outside of the grid\n");
         }
+        return Point{record.x, record.y};
+    };
 
-        Width length;
-        ist >> length;
-        if (!ist) {
-            is.setstate(std::ios_base::failbit);
-            return is;
-        }
+    const auto* position = data + sizeof(header);
 
-        Height height;
-        ist >> height;
-        if (!ist) {
-            is.setstate(std::ios_base::failbit);
-            return is;
-        }
+    std::vector<Brick> bricks;
+    bricks.reserve(header.brickCount);
+    for (std::uint32_t i = 0; i < header.brickCount; ++i) {
+        impl::BinaryBrickRecord record;
+        std::memcpy(&record, position, sizeof(record));
+        position += sizeof(record);
+        bricks.emplace_back(checkRecord(record), Width{record.width},
+                            Height{record.height}, Hitpoints{record.hitpoints});
+    }
 
-        Hitpoints hitpoints;
-        ist >> hitpoints;
-        if (!ist) {
-            indestructibleBricks.emplace_back(
-                IndestructibleBrick{point, length, height});
-        }
-        else {
-            bricks.emplace_back(Brick{point, length, height, hitpoints});
-        }
+    std::vector<IndestructibleBrick> indestructibleBricks;
+    indestructibleBricks.reserve(header.indestructibleBrickCount);
+    for (std::uint32_t i = 0; i < header.indestructibleBrickCount; ++i) {
+        impl::BinaryIndestructibleBrickRecord record;
+        std::memcpy(&record, position, sizeof(record));
+        position += sizeof(record);
+        indestructibleBricks.emplace_back(
+            checkRecord(record), Width{record.width}, Height{record.height});
     }
 
-    obj = std::move(Level{DifficultyParameters{}, gridWidth, gridHeight, bricks,
-                          indestructibleBricks});
-    return is;
+    return Level{DifficultyParameters{}, gridWidth, gridHeight,
+                 std::move(bricks), std::move(indestructibleBricks)};
+}
+
+Level readLevel(const std::string& filename)
+{
+    if (impl::isBinaryLevelFilename(filename)) {
+        return readFromBinaryFile(filename);
+    }
+    return readFromFile(filename);
 }
 
 namespace impl {
 
-bool isComment(const std::string line)
+bool isBinaryLevelFilename(const std::string& filename)
 {
-    std::istringstream ist{line};
-
-    char c;
-    ist >> c;
-    return c == '#';
+    std::string extension{binaryLevelExtension};
+    return filename.size() >= extension.size() &&
+           filename.compare(filename.size() - extension.size(),
+                            extension.size(), extension) == 0;
 }
 
 Point platformInitPosition(double platformWidth, double gridWidth,
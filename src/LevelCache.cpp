@@ -0,0 +1,65 @@
+#include "LevelCache.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace bricks {
+
+LevelCache::LevelCache(std::vector<std::string> levelFilenames)
+    : mLevelFilenames{std::move(levelFilenames)},
+      mLevels(mLevelFilenames.size())
+{
+}
+
+std::size_t LevelCache::size() const
+{
+    return mLevelFilenames.size();
+}
+
+Level LevelCache::level(int levelIDX)
+{
+    return *request(levelIDX, std::launch::deferred).get();
+}
+
+void LevelCache::prefetch(int levelIDX)
+{
+    request(levelIDX, std::launch::async);
+}
+
+std::size_t LevelCache::maxBrickCount()
+{
+    std::size_t count{0};
+    for (int levelIDX = 1; levelIDX <= static_cast<int>(size()); ++levelIDX) {
+        const auto& level = request(levelIDX, std::launch::deferred).get();
+        count = std::max(count, level->bricks.size());
+    }
+    return count;
+}
+
+LevelCache::LevelFuture LevelCache::request(int levelIDX, std::launch policy)
+{
+    if (levelIDX < 1 || levelIDX > static_cast<int>(mLevelFilenames.size())) {
+        throw std::out_of_range("LevelCache::LevelFuture "
+                                "LevelCache::request(int levelIDX, "
+                                "std::launch policy)\n"
+                                "No level " +
+                                std::to_string(levelIDX) + "\n");
+    }
+
+    std::lock_guard<std::mutex> lock{mMutex};
+    auto& future = mLevels[static_cast<std::size_t>(levelIDX - 1)];
+    if (!future.valid()) {
+        const auto& filename =
+            mLevelFilenames[static_cast<std::size_t>(levelIDX - 1)];
+        auto load = [filename]() -> std::shared_ptr<const Level> {
+            return std::make_shared<const Level>(readLevel(filename));
+        };
+        // A deferred load runs in the first thread calling get() on it
+        future = std::async(policy, load).share();
+    }
+    return future;
+}
+
+} // namespace bricks
@@ -0,0 +1,206 @@
+#include "LevelParser.h"
+
+#include "Level.h"
+
+#include "types/GridHeight.h"
+#include "types/GridWidth.h"
+#include "types/Height.h"
+#include "types/Hitpoints.h"
+#include "types/Point.h"
+#include "types/Width.h"
+
+#include "utility/IsNumber.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace bricks {
+
+using Point = types::Point;
+using Width = types::Width;
+using Height = types::Height;
+using Hitpoints = types::Hitpoints;
+using GridWidth = types::GridWidth;
+using GridHeight = types::GridHeight;
+
+using Brick = game_objects::Brick;
+using IndestructibleBrick = game_objects::IndestructibleBrick;
+
+LevelParseError::LevelParseError(const std::string& sourceName, int line,
+                                 int column, const std::string& reason)
+    : std::runtime_error{sourceName + ":" + std::to_string(line) + ":" +
+                         std::to_string(column) + ": " + reason + "\n"},
+      mLine{line}, mColumn{column}
+{
+}
+
+int LevelParseError::line() const
+{
+    return mLine;
+}
+
+int LevelParseError::column() const
+{
+    return mColumn;
+}
+
+Level parseLevel(std::string_view text, const std::string& sourceName)
+{
+    impl::LevelTokenizer tokens{text, sourceName};
+
+    // The types check their values, report what they reject at the number
+    auto checked = [&tokens](const auto& field, std::string_view keyword,
+                             auto make) {
+        try {
+            return make(field.value);
+        }
+        catch (const std::invalid_argument&) {
+            tokens.fail(field.column,
+                        "invalid value for " + std::string{keyword});
+        }
+    };
+
+    if (!tokens.nextLine()) {
+        tokens.fail("missing grid size");
+    }
+    auto w = impl::parseField<int>(tokens, "W");
+    auto h = impl::parseField<int>(tokens, "H");
+    impl::expectLineEnd(tokens);
+    auto gridWidth = checked(w, "W", [](int v) { return GridWidth{v}; });
+    auto gridHeight = checked(h, "H", [](int v) { return GridHeight{v}; });
+
+    std::vector<Brick> bricks;
+    std::vector<IndestructibleBrick> indestructibleBricks;
+
+    while (tokens.nextLine()) {
+        auto x = impl::parseField<double>(tokens, "X");
+        auto y = impl::parseField<double>(tokens, "Y");
+        auto width = impl::parseField<double>(tokens, "W");
+        auto height = impl::parseField<double>(tokens, "H");
+
+        if (x.value < 0.0 || x.value > gridWidth()) {
+            tokens.fail(x.column, "X is outside of the grid");
+        }
+        if (y.value < 0.0 || y.value > gridHeight()) {
+            tokens.fail(y.column, "Y is outside of the grid");
+        }
+        Point point{x.value, y.value};
+        auto brickWidth =
+            checked(width, "W", [](double v) { return Width{v}; });
+        auto brickHeight =
+            checked(height, "H", [](double v) { return Height{v}; });
+
+        auto keyword = tokens.nextToken();
+        if (keyword.empty()) {
+            indestructibleBricks.emplace_back(point, brickWidth, brickHeight);
+            continue;
+        }
+        if (keyword != "HP") {
+            tokens.fail("expected HP or end of line");
+        }
+        auto hitpointsToken = tokens.nextToken();
+        auto hitpoints = utility::parseNumber<int>(hitpointsToken);
+        if (!hitpoints) {
+            tokens.fail("expected a whole number after HP");
+        }
+        impl::Field<int> field{*hitpoints, tokens.column()};
+        impl::expectLineEnd(tokens);
+        bricks.push_back(checked(field, "HP", [&](int v) {
+            return Brick{point, brickWidth, brickHeight, Hitpoints{v}};
+        }));
+    }
+
+    return Level{DifficultyParameters{}, gridWidth, gridHeight,
+                 std::move(bricks), std::move(indestructibleBricks)};
+}
+
+namespace impl {
+
+LevelTokenizer::LevelTokenizer(std::string_view text, std::string sourceName)
+    : mText{text}, mSourceName{std::move(sourceName)}
+{
+}
+
+bool LevelTokenizer::nextLine()
+{
+    while (mNextLineStart < mText.size()) {
+        mLineStart = mNextLineStart;
+        auto newline = mText.find('\n', mLineStart);
+        mLineEnd = newline == std::string_view::npos ? mText.size() : newline;
+        mNextLineStart = std::min(mLineEnd + 1, mText.size());
+        ++mLine;
+
+        mPosition = mLineStart;
+        auto first = nextToken();
+        if (!first.empty() && first.front() != '#') {
+            mPosition = mLineStart;
+            mTokenStart = mLineStart;
+            return true;
+        }
+    }
+    mLineStart = mLineEnd = mPosition = mTokenStart = mText.size();
+    return false;
+}
+
+std::string_view LevelTokenizer::nextToken()
+{
+    while (mPosition < mLineEnd && isBlank(mText[mPosition])) {
+        ++mPosition;
+    }
+    mTokenStart = mPosition;
+    while (mPosition < mLineEnd && !isBlank(mText[mPosition])) {
+        ++mPosition;
+    }
+    return mText.substr(mTokenStart, mPosition - mTokenStart);
+}
+
+int LevelTokenizer::line() const
+{
+    return std::max(mLine, 1);
+}
+
+int LevelTokenizer::column() const
+{
+    return static_cast<int>(mTokenStart - mLineStart) + 1;
+}
+
+void LevelTokenizer::fail(const std::string& reason) const
+{
+    fail(column(), reason);
+}
+
+void LevelTokenizer::fail(int column, const std::string& reason) const
+{
+    throw LevelParseError{mSourceName, line(), column, reason};
+}
+
+template <typename Number>
+Field<Number> parseField(LevelTokenizer& tokens, std::string_view keyword)
+{
+    if (tokens.nextToken() != keyword) {
+        tokens.fail("expected " + std::string{keyword});
+    }
+    auto token = tokens.nextToken();
+    auto number = utility::parseNumber<Number>(token);
+    if (!number) {
+        tokens.fail("expected a number after " + std::string{keyword});
+    }
+    return Field<Number>{*number, tokens.column()};
+}
+
+void expectLineEnd(LevelTokenizer& tokens)
+{
+    if (!tokens.nextToken().empty()) {
+        tokens.fail("expected end of line");
+    }
+}
+
+bool isBlank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+} // namespace impl
+
+} // namespace bricks
@@ -0,0 +1,67 @@
+#include "Palette.h"
+
+#include <cassert>
+
+namespace bricks {
+
+using RGBColor = types::RGBColor;
+
+Palette::Palette()
+{
+    std::vector<RGBColor> brickColors{
+        RGBColor{0xFD, 0xEF, 0x42}, RGBColor{0x99, 0xFF, 0x00},
+        RGBColor{0x00, 0x7E, 0x56}, RGBColor{0x00, 0x5A, 0x7E},
+        RGBColor{0x46, 0x3A, 0xCB}, RGBColor{0xF4, 0x0b, 0xEC},
+        RGBColor{0xA4, 0x4E, 0xFE}, RGBColor{0xFF, 0x7B, 0x00},
+        RGBColor{0xF4, 0x46, 0x11}};
+
+    // Same order as PaletteObject
+    std::vector<RGBColor> objectColors{
+        RGBColor{0x1E, 0x1E, 0x1E}, RGBColor{0xCC, 0xFF, 0xFF},
+        RGBColor{0xBF, 0xBF, 0xBF}, RGBColor{0xBF, 0x80, 0x40},
+        RGBColor{0xFF, 0x00, 0x00}};
+
+    assert(brickColors.size() == static_cast<std::size_t>(maxBrickHitpoints));
+    assert(objectColors.size() == objectCount);
+
+    addColors(mBricks, brickColors);
+    addColors(mObjects, objectColors);
+}
+
+const Shades& Palette::brick(int hitpoints, bool paused) const
+{
+    assert(hitpoints >= 1 && hitpoints <= maxBrickHitpoints);
+
+    auto idx = static_cast<std::size_t>(hitpoints - 1);
+    if (paused) {
+        idx += static_cast<std::size_t>(maxBrickHitpoints);
+    }
+    return mBricks[idx];
+}
+
+const Shades& Palette::object(PaletteObject object, bool paused) const
+{
+    auto idx = static_cast<std::size_t>(object);
+    if (paused) {
+        idx += objectCount;
+    }
+    return mObjects[idx];
+}
+
+void Palette::addColors(std::vector<Shades>& shades,
+                        const std::vector<RGBColor>& colors)
+{
+    for (const auto& color : colors) {
+        shades.push_back(makeShades(color));
+    }
+    for (const auto& color : colors) {
+        shades.push_back(makeShades(color.grayscale()));
+    }
+}
+
+Shades makeShades(const RGBColor& color)
+{
+    return Shades{color, color.lighter(), color.darker()};
+}
+
+} // namespace bricks
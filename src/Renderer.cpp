@@ -1,14 +1,16 @@
 #include "Renderer.h"
 
 #include "game_objects/Ball.h"
-#include "game_objects/Brick.h"
+#include "game_objects/BrickColumns.h"
 #include "game_objects/IndestructibleBrick.h"
 #include "game_objects/Platform.h"
 #include "game_objects/Wall.h"
 
+#include "types/Point.h"
 #include "types/RGBColor.h"
 
 #include "Level.h"
+#include "Palette.h"
 #include "SDL_RAII.h"
 
 #include <array>
@@ -21,23 +23,26 @@
 namespace bricks {
 
 using Ball = game_objects::Ball;
-using Brick = game_objects::Brick;
+using BrickColumns = game_objects::BrickColumns;
 using GameObject = game_objects::GameObject;
 using IndestructibleBrick = game_objects::IndestructibleBrick;
 using Platform = game_objects::Platform;
 using Wall = game_objects::Wall;
 
+using Point = types::Point;
 using RGBColor = types::RGBColor;
 
 Renderer::Renderer(const std::size_t screenWidth,
                    const std::size_t screenHeight, const std::size_t gridWidth,
-                   const std::size_t gridHeight)
+                   const std::size_t gridHeight, RenderMode renderMode,
+                   bool vsync)
     : mScreenWidth{screenWidth}, mScreenHeight{screenHeight},
       mGridWidth{gridWidth}, mGridHeight{gridHeight},
       mWidthFactor{static_cast<double>(mScreenWidth) /
                    static_cast<double>(mGridWidth)},
       mHeightFactor{static_cast<double>(mScreenHeight) /
-                    static_cast<double>(mGridHeight)}
+                    static_cast<double>(mGridHeight)},
+      mRenderMode{renderMode}
 {
 
     SDL_RAII::init();
@@ -52,31 +57,61 @@ Renderer::Renderer(const std::size_t screenWidth,
                                  "SDL_Error: " + SDL_GetError() + "\n");
     }
 
+    Uint32 flags = SDL_RENDERER_ACCELERATED;
+    if (vsync) {
+        flags |= SDL_RENDERER_PRESENTVSYNC;
+    }
     mSdlRenderer = std::unique_ptr<SDL_Renderer, SDLRendererDeleter>(
-        SDL_CreateRenderer(mSdlWindow.get(), -1, SDL_RENDERER_ACCELERATED));
+        SDL_CreateRenderer(mSdlWindow.get(), -1, flags));
     if (mSdlRenderer == nullptr) {
         throw std::runtime_error(std::string{"Renderer\n"} +
                                  "Renderer could not be created.\n" +
                                  "SDL_Error: " + SDL_GetError() + "\n");
     }
+
+    createLayers();
+    SDL_AddEventWatch(watchRenderResets, this);
+}
+
+Renderer::~Renderer()
+{
+    SDL_DelEventWatch(watchRenderResets, this);
 }
 
 void Renderer::render(const Level& level)
 {
-    clearScreen();
-    render(level.ball);
-    render(level.platform);
-    render(level.leftWall());
-    render(level.rightWall());
-    render(level.topWall());
+    render(level, level.ball.topLeft(), level.platform.topLeft());
+}
+
+void Renderer::render(const Level& level, const Point& ballTopLeft,
+                      const Point& platformTopLeft)
+{
+    auto ball = level.ball;
+    ball.setTopLeft(ballTopLeft);
+    auto platform = level.platform;
+    platform.setTopLeft(platformTopLeft);
+
+    handleRenderResets();
 
-    for (const auto& brick : level.bricks) {
-        render(brick);
+    if (mBackBuffer != nullptr) {
+        renderIncremental(level, ball, platform);
+        return;
     }
-    for (const auto& indestructibleBrick : level.indestructibleBricks) {
-        render(indestructibleBrick);
+
+    clearScreen();
+    if (mStaticLayer != nullptr) {
+        updateStaticLayer(level);
+        updateBrickLayer(level.brickGrid.columns());
+        copyLayers(nullptr);
+    }
+    else {
+        renderStaticObjects(level);
+        render(level.brickGrid.columns());
     }
+    render(ball);
+    render(platform);
     updateScreen();
+    mChangedBricks.clear();
 }
 
 void Renderer::setWindowTitle(const std::string& title)
@@ -87,99 +122,333 @@ void Renderer::setWindowTitle(const std::string& title)
 void Renderer::setPaused(bool paused)
 {
     mPaused = paused;
+    invalidateLayers();
+}
+
+void Renderer::invalidateLayers()
+{
+    mStaticLayerDirty = true;
+    mBrickLayerDirty = true;
+    // Everything is drawn again, the indices may be of the previous level
+    mChangedBricks.clear();
+}
+
+void Renderer::invalidateBricks(const std::vector<std::size_t>& brickIndices)
+{
+    mChangedBricks.insert(mChangedBricks.end(), brickIndices.begin(),
+                          brickIndices.end());
 }
 
 void Renderer::clearScreen()
 {
-    RGBColor white{0x1E, 0x1E, 0x1E};
+    setDrawColor(backgroundColor());
+    SDL_RenderClear(mSdlRenderer.get());
+}
+
+const RGBColor& Renderer::backgroundColor() const
+{
+    return mPalette.object(PaletteObject::background, mPaused).base;
+}
+
+void Renderer::updateScreen()
+{
+    SDL_RenderPresent(mSdlRenderer.get());
+}
 
-    if (!mPaused) {
-        setDrawColor(white);
+int Renderer::watchRenderResets(void* userdata, SDL_Event* event)
+{
+    auto* renderer = static_cast<Renderer*>(userdata);
+    if (event->type == SDL_RENDER_TARGETS_RESET) {
+        renderer->mTargetsReset = true;
     }
-    else {
-        setDrawColor(white.grayscale());
+    else if (event->type == SDL_RENDER_DEVICE_RESET) {
+        renderer->mDeviceReset = true;
+    }
+    return 0;
+}
+
+void Renderer::handleRenderResets()
+{
+    if (mDeviceReset) {
+        createLayers();
+    }
+    if (mDeviceReset || mTargetsReset) {
+        invalidateLayers();
+    }
+    mDeviceReset = false;
+    mTargetsReset = false;
+}
+
+void Renderer::createLayers()
+{
+    mStaticLayer.reset();
+    mBrickLayer.reset();
+    mBackBuffer.reset();
+    if (SDL_RenderTargetSupported(mSdlRenderer.get()) == SDL_FALSE) {
+        return;
+    }
+
+    mStaticLayer = createLayer();
+    mBrickLayer = createLayer();
+    if (mStaticLayer == nullptr || mBrickLayer == nullptr) {
+        mStaticLayer.reset();
+        mBrickLayer.reset();
+        return;
     }
+    if (mRenderMode == RenderMode::incremental) {
+        mBackBuffer = createLayer();
+    }
+}
+
+std::unique_ptr<SDL_Texture, SDLTextureDeleter> Renderer::createLayer()
+{
+    std::unique_ptr<SDL_Texture, SDLTextureDeleter> layer{SDL_CreateTexture(
+        mSdlRenderer.get(), SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+        static_cast<int>(mScreenWidth), static_cast<int>(mScreenHeight))};
+    if (layer != nullptr) {
+        SDL_SetTextureBlendMode(layer.get(), SDL_BLENDMODE_BLEND);
+    }
+    return layer;
+}
+
+void Renderer::beginLayer(SDL_Texture* layer)
+{
+    SDL_SetRenderTarget(mSdlRenderer.get(), layer);
+    SDL_SetRenderDrawColor(mSdlRenderer.get(), 0, 0, 0, 0);
     SDL_RenderClear(mSdlRenderer.get());
 }
 
-void Renderer::updateScreen()
+void Renderer::endLayer()
 {
-    SDL_RenderPresent(mSdlRenderer.get());
+    SDL_SetRenderTarget(mSdlRenderer.get(), nullptr);
+}
+
+void Renderer::updateStaticLayer(const Level& level)
+{
+    if (!mStaticLayerDirty) {
+        return;
+    }
+    beginLayer(mStaticLayer.get());
+    renderStaticObjects(level);
+    endLayer();
+    mStaticLayerDirty = false;
+}
+
+void Renderer::updateBrickLayer(const BrickColumns& brickColumns)
+{
+    if (!mBrickLayerDirty && mChangedBricks.empty()) {
+        return;
+    }
+    beginLayer(mBrickLayer.get());
+    render(brickColumns);
+    endLayer();
+    mBrickLayerDirty = false;
+}
+
+void Renderer::copyLayers(const SDL_Rect* rect)
+{
+    SDL_RenderCopy(mSdlRenderer.get(), mStaticLayer.get(), rect, rect);
+    SDL_RenderCopy(mSdlRenderer.get(), mBrickLayer.get(), rect, rect);
+}
+
+void Renderer::renderIncremental(const Level& level, const Ball& ball,
+                                 const Platform& platform)
+{
+    const auto& brickColumns = level.brickGrid.columns();
+
+    auto redrawAll = mStaticLayerDirty || mBrickLayerDirty;
+    if (!redrawAll) {
+        addChangedBricks(brickColumns);
+    }
+    updateStaticLayer(level);
+    updateBrickLayer(brickColumns);
+
+    auto ballRect = withBevel(toSDLRect(ball));
+    auto platformRect = withBevel(toSDLRect(platform));
+    mDirtyRegions.add(toScreenRect(mLastBallRect));
+    mDirtyRegions.add(toScreenRect(ballRect));
+    mDirtyRegions.add(toScreenRect(mLastPlatformRect));
+    mDirtyRegions.add(toScreenRect(platformRect));
+    mLastBallRect = ballRect;
+    mLastPlatformRect = platformRect;
+
+    SDL_SetRenderTarget(mSdlRenderer.get(), mBackBuffer.get());
+    if (redrawAll) {
+        clearScreen();
+        copyLayers(nullptr);
+        render(ball);
+        render(platform);
+    }
+    else {
+        for (const auto& dirtyRect : mDirtyRegions.rects()) {
+            redrawRegion(toSDLRect(dirtyRect), ball, platform);
+        }
+    }
+    mDirtyRegions.clear();
+    mChangedBricks.clear();
+
+    SDL_SetRenderTarget(mSdlRenderer.get(), nullptr);
+    SDL_RenderCopy(mSdlRenderer.get(), mBackBuffer.get(), nullptr, nullptr);
+    updateScreen();
+}
+
+void Renderer::redrawRegion(const SDL_Rect& rect, const Ball& ball,
+                            const Platform& platform)
+{
+    SDL_RenderSetClipRect(mSdlRenderer.get(), &rect);
+    setDrawColor(backgroundColor());
+    SDL_RenderFillRect(mSdlRenderer.get(), &rect);
+    copyLayers(&rect);
+    render(ball);
+    render(platform);
+    SDL_RenderSetClipRect(mSdlRenderer.get(), nullptr);
+}
+
+void Renderer::addChangedBricks(const BrickColumns& brickColumns)
+{
+    for (auto i : mChangedBricks) {
+        mDirtyRegions.add(toScreenRect(withBevel(
+            toSDLRect(brickColumns.x()[i], brickColumns.y()[i],
+                      brickColumns.width()[i], brickColumns.height()[i]))));
+    }
+}
+
+void Renderer::renderStaticObjects(const Level& level)
+{
+    render(level.leftWall());
+    render(level.rightWall());
+    render(level.topWall());
+    for (const auto& indestructibleBrick : level.indestructibleBricks) {
+        render(indestructibleBrick);
+    }
 }
 
 void Renderer::render(const Ball& ball)
 {
-    RGBColor lightBlue{0xCC, 0xFF, 0xFF};
-    render(ball, lightBlue);
+    render(ball, mPalette.object(PaletteObject::ball, mPaused));
 }
 
 void Renderer::render(const Platform& platform)
 {
-    RGBColor gray{0xBF, 0xBF, 0xBF};
-    render(platform, gray);
+    render(platform, mPalette.object(PaletteObject::platform, mPaused));
 }
 
 void Renderer::render(const Wall& wall)
 {
-    RGBColor brown{0xBF, 0x80, 0x40};
-    render(wall, brown);
+    render(wall, mPalette.object(PaletteObject::wall, mPaused));
 }
 
-void Renderer::render(const Brick& brick)
+void Renderer::render(const BrickColumns& brickColumns)
 {
-    if (brick.isDestroyed()) {
-        return;
+    const auto& x = brickColumns.x();
+    const auto& y = brickColumns.y();
+    const auto& width = brickColumns.width();
+    const auto& height = brickColumns.height();
+    const auto& hitpoints = brickColumns.hitpoints();
+
+    for (auto& batch : mBrickBatches) {
+        batch.clear();
+    }
+    for (std::size_t i = 0; i < brickColumns.size(); ++i) {
+        if (hitpoints[i] <= 0) {
+            continue;
+        }
+        assert(hitpoints[i] <= Palette::maxBrickHitpoints);
+        mBrickBatches[static_cast<std::size_t>(hitpoints[i] - 1)].add(
+            toSDLRect(x[i], y[i], width[i], height[i]));
+    }
+
+    auto shades = [this](std::size_t i) -> const Shades& {
+        return mPalette.brick(static_cast<int>(i) + 1, mPaused);
+    };
+
+    // All fills first, so no brick covers the bevel of its neighbour.
+    for (std::size_t i = 0; i < mBrickBatches.size(); ++i) {
+        fillRects(mBrickBatches[i].fills, shades(i).base);
+    }
+    for (std::size_t i = 0; i < mBrickBatches.size(); ++i) {
+        fillRects(mBrickBatches[i].highlights, shades(i).lighter);
+    }
+    for (std::size_t i = 0; i < mBrickBatches.size(); ++i) {
+        fillRects(mBrickBatches[i].shadows, shades(i).darker);
     }
-    auto color = getBrickDrawColor(brick);
-    render(brick, color);
 }
 
 void Renderer::render(const IndestructibleBrick& indestructibleBrick)
 {
-    RGBColor red{0xFF, 0x00, 0x00};
-    render(indestructibleBrick, red);
+    render(indestructibleBrick,
+           mPalette.object(PaletteObject::indestructibleBrick, mPaused));
 }
 
-void Renderer::render(const GameObject& obj, RGBColor color)
+void Renderer::render(const GameObject& obj, const Shades& shades)
 {
-    if (mPaused) {
-        color = color.grayscale();
-    }
-    setDrawColor(color);
-    auto rect = toSDLRect(obj);
+    render(toSDLRect(obj), shades);
+}
+
+void Renderer::render(const SDL_Rect& rect, const Shades& shades)
+{
+    setDrawColor(shades.base);
     SDL_RenderFillRect(mSdlRenderer.get(), &rect);
-    drawHighlights(rect, color);
+    drawHighlights(rect, shades);
 }
 
-void Renderer::drawHighlights(const SDL_Rect& rect, const RGBColor& color)
+void Renderer::drawHighlights(const SDL_Rect& rect, const Shades& shades)
 {
     auto x = rect.x;
     auto y = rect.y;
     auto w = rect.w;
     auto h = rect.h;
 
-    setDrawColor(color.lighter());
+    setDrawColor(shades.lighter);
     SDL_RenderDrawLine(mSdlRenderer.get(), x, y + h, x, y);
     SDL_RenderDrawLine(mSdlRenderer.get(), x + 1, y + h, x + 1, y);
     SDL_RenderDrawLine(mSdlRenderer.get(), x, y, x + w, y);
     SDL_RenderDrawLine(mSdlRenderer.get(), x, y + 1, x + w, y + 1);
 
-    setDrawColor(color.darker());
+    setDrawColor(shades.darker);
     SDL_RenderDrawLine(mSdlRenderer.get(), x, y + h, x + w, y + h);
     SDL_RenderDrawLine(mSdlRenderer.get(), x, y + h - 1, x + w, y + h - 1);
     SDL_RenderDrawLine(mSdlRenderer.get(), x + w, y + h, x + w, y);
     SDL_RenderDrawLine(mSdlRenderer.get(), x + w - 1, y + h, x + w - 1, y);
 }
 
+void Renderer::fillRects(const std::vector<SDL_Rect>& rects,
+                         const RGBColor& color)
+{
+    if (rects.empty()) {
+        return;
+    }
+    setDrawColor(color);
+    SDL_RenderFillRects(mSdlRenderer.get(), rects.data(),
+                        static_cast<int>(rects.size()));
+}
+
 SDL_Rect Renderer::toSDLRect(const GameObject& obj) const
 {
-    SDL_Rect rect;
-    rect.w = mWidthFactor * obj.width();
-    rect.h = mHeightFactor * obj.height();
     auto p = obj.topLeft();
-    rect.x = mWidthFactor * p.x;
-    rect.y = mHeightFactor * p.y;
-    return rect;
+    return toSDLRect(p.x, p.y, obj.width(), obj.height());
+}
+
+SDL_Rect Renderer::toSDLRect(double x, double y, double width,
+                             double height) const
+{
+    return toSDLRect(bricks::toScreenRect(x, y, width, height, mWidthFactor,
+                                          mHeightFactor));
+}
+
+SDL_Rect Renderer::toSDLRect(const ScreenRect& rect)
+{
+    return SDL_Rect{rect.x, rect.y, rect.w, rect.h};
+}
+
+ScreenRect Renderer::toScreenRect(const SDL_Rect& rect)
+{
+    return ScreenRect{rect.x, rect.y, rect.w, rect.h};
+}
+
+SDL_Rect Renderer::withBevel(const SDL_Rect& rect)
+{
+    return toSDLRect(bricks::withBevel(toScreenRect(rect)));
 }
 
 void Renderer::setDrawColor(const RGBColor& color)
@@ -188,19 +457,23 @@ void Renderer::setDrawColor(const RGBColor& color)
                            color.a());
 }
 
-RGBColor Renderer::getBrickDrawColor(const Brick& brick)
+void RectBatch::clear()
 {
-    auto hp = brick.hitpoints();
-
-    assert(hp >= 0 && hp <= 9);
+    fills.clear();
+    highlights.clear();
+    shadows.clear();
+}
 
-    std::array<RGBColor, 9> colors{
-        RGBColor{0xFD, 0xEF, 0x42}, RGBColor{0x99, 0xFF, 0x00},
-        RGBColor{0x00, 0x7E, 0x56}, RGBColor{0x00, 0x5A, 0x7E},
-        RGBColor{0x46, 0x3A, 0xCB}, RGBColor{0xF4, 0x0b, 0xEC},
-        RGBColor{0xA4, 0x4E, 0xFE}, RGBColor{0xFF, 0x7B, 0x00},
-        RGBColor{0xF4, 0x46, 0x11}};
+void RectBatch::add(const SDL_Rect& rect)
+{
+    fills.push_back(rect);
 
-    return RGBColor{colors.at(static_cast<std::size_t>(hp - 1))};
+    auto screenRect = Renderer::toScreenRect(rect);
+    for (const auto& highlight : bevelHighlights(screenRect)) {
+        highlights.push_back(Renderer::toSDLRect(highlight));
+    }
+    for (const auto& shadow : bevelShadows(screenRect)) {
+        shadows.push_back(Renderer::toSDLRect(shadow));
+    }
 }
 } // namespace bricks
\ No newline at end of file
@@ -0,0 +1,216 @@
+#include "Replay.h"
+
+#include "Simulation.h"
+
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+
+namespace bricks {
+
+using Event = InputHandler::Event;
+
+using Gravity = types::Gravity;
+using Velocity = types::Velocity;
+using Width = types::Width;
+
+constexpr char replayMagic[4] = {'B', 'R', 'K', 'R'};
+constexpr std::uint8_t replayVersion{2};
+
+void writeReplay(std::ostream& os, const Replay& replay)
+{
+    os.write(replayMagic, sizeof(replayMagic));
+    os.put(static_cast<char>(replayVersion));
+
+    impl::writeUInt64(os, replay.seed);
+    impl::writeDouble(os, replay.platformDeviation);
+    const auto& parameters = replay.difficultyParameters;
+    impl::writeDouble(os, parameters.getPlatformVelocity()());
+    impl::writeDouble(os, parameters.getPlatformWidth()());
+    impl::writeDouble(os, parameters.getBallVelocity()());
+    impl::writeDouble(os, parameters.getBallGravity()());
+    impl::writeDouble(os, replay.tickMS);
+    impl::writeUInt64(os, replay.events.size());
+
+    const auto& events = replay.events;
+    for (std::size_t first = 0; first < events.size();) {
+        auto last = first + 1;
+        while (last < events.size() && events[last] == events[first]) {
+            ++last;
+        }
+        os.put(static_cast<char>(events[first]));
+        impl::writeVarUInt(os, last - first);
+        first = last;
+    }
+}
+
+Replay readReplay(std::istream& is)
+{
+    char magic[sizeof(replayMagic)]{};
+    is.read(magic, sizeof(magic));
+    if (!is || std::memcmp(magic, replayMagic, sizeof(magic)) != 0) {
+        throw std::runtime_error("Replay readReplay(std::istream& is)\n"
+                                 "Not a replay\n");
+    }
+    if (impl::readByte(is) != replayVersion) {
+        throw std::runtime_error("Replay readReplay(std::istream& is)\n"
+                                 "Unsupported replay version\n");
+    }
+
+    Replay replay;
+    replay.seed = impl::readUInt64(is);
+    replay.platformDeviation = impl::readDouble(is);
+    auto platformVelocity = impl::readDouble(is);
+    auto platformWidth = impl::readDouble(is);
+    auto ballVelocity = impl::readDouble(is);
+    auto ballGravity = impl::readDouble(is);
+    replay.difficultyParameters = DifficultyParameters{
+        Velocity{platformVelocity}, Width{platformWidth},
+        Velocity{ballVelocity}, Gravity{ballGravity}};
+    replay.tickMS = impl::readDouble(is);
+
+    auto ticks = impl::readUInt64(is);
+    while (replay.events.size() < ticks) {
+        auto event = impl::readByte(is);
+        auto count = impl::readVarUInt(is);
+        if (event > static_cast<std::uint8_t>(Event::p) || count == 0 ||
+            count > ticks - replay.events.size()) {
+            throw std::runtime_error("Replay readReplay(std::istream& is)\n"
+                                     "Corrupt event run\n");
+        }
+        replay.events.insert(replay.events.end(), count,
+                             static_cast<Event>(event));
+    }
+    return replay;
+}
+
+void saveReplay(const std::string& filename, const Replay& replay)
+{
+    std::ofstream ofs{filename, std::ios::binary};
+    if (!ofs) {
+        throw std::runtime_error("File:" + filename + " could not be opened\n");
+    }
+    writeReplay(ofs, replay);
+}
+
+Replay loadReplay(const std::string& filename)
+{
+    std::ifstream ifs{filename, std::ios::binary};
+    if (!ifs) {
+        throw std::runtime_error("File:" + filename + " could not be opened\n");
+    }
+    return readReplay(ifs);
+}
+
+HeadlessResult runReplay(Simulation& simulation, const Replay& replay,
+                         const TickCallback& onTick)
+{
+    HeadlessResult result;
+
+    for (const auto& event : replay.events) {
+        if (simulation.isGameOver()) {
+            simulation.restart();
+        }
+        simulation.step(event, replay.tickMS);
+        ++result.ticks;
+        if (onTick) {
+            onTick(simulation);
+        }
+        if (simulation.isQuit()) {
+            break;
+        }
+    }
+
+    result.score = simulation.score();
+    result.level = simulation.currentLevel();
+    result.lifes = simulation.lifes();
+    result.playthroughs = simulation.playthroughs();
+    result.gameOver = simulation.isGameOver();
+    return result;
+}
+
+InputScript makeRecordingInput(InputScript input, Replay& replay)
+{
+    return [input = std::move(input), &replay](const Level& level) {
+        auto event = input(level);
+        replay.events.push_back(event);
+        return event;
+    };
+}
+
+namespace impl {
+
+void writeUInt64(std::ostream& os, std::uint64_t value)
+{
+    char bytes[8];
+    for (auto& byte : bytes) {
+        byte = static_cast<char>(value & 0xffU);
+        value >>= 8U;
+    }
+    os.write(bytes, sizeof(bytes));
+}
+
+std::uint64_t readUInt64(std::istream& is)
+{
+    std::uint64_t value{0};
+    for (unsigned shift = 0; shift < 64; shift += 8) {
+        value |= static_cast<std::uint64_t>(readByte(is)) << shift;
+    }
+    return value;
+}
+
+void writeDouble(std::ostream& os, double value)
+{
+    std::uint64_t bits;
+    static_assert(sizeof(bits) == sizeof(value));
+    std::memcpy(&bits, &value, sizeof(bits));
+    writeUInt64(os, bits);
+}
+
+double readDouble(std::istream& is)
+{
+    auto bits = readUInt64(is);
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+void writeVarUInt(std::ostream& os, std::uint64_t value)
+{
+    while (value >= 0x80U) {
+        os.put(static_cast<char>((value & 0x7fU) | 0x80U));
+        value >>= 7U;
+    }
+    os.put(static_cast<char>(value));
+}
+
+std::uint64_t readVarUInt(std::istream& is)
+{
+    std::uint64_t value{0};
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        auto byte = readByte(is);
+        value |= static_cast<std::uint64_t>(byte & 0x7fU) << shift;
+        if ((byte & 0x80U) == 0) {
+            return value;
+        }
+    }
+    throw std::runtime_error("std::uint64_t readVarUInt(std::istream& is)\n"
+                             "Varint is too long\n");
+}
+
+std::uint8_t readByte(std::istream& is)
+{
+    auto c = is.get();
+    if (c == std::istream::traits_type::eof()) {
+        throw std::runtime_error("std::uint8_t readByte(std::istream& is)\n"
+                                 "Unexpected end of replay\n");
+    }
+    return static_cast<std::uint8_t>(c);
+}
+
+} // namespace impl
+
+} // namespace bricks
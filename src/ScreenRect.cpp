@@ -0,0 +1,58 @@
+#include "ScreenRect.h"
+
+#include <algorithm>
+
+namespace bricks {
+
+bool operator==(const ScreenRect& a, const ScreenRect& b)
+{
+    return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+}
+
+bool operator!=(const ScreenRect& a, const ScreenRect& b)
+{
+    return !(a == b);
+}
+
+bool overlaps(const ScreenRect& a, const ScreenRect& b)
+{
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h &&
+           b.y < a.y + a.h;
+}
+
+ScreenRect unite(const ScreenRect& a, const ScreenRect& b)
+{
+    auto left = std::min(a.x, b.x);
+    auto top = std::min(a.y, b.y);
+    auto right = std::max(a.x + a.w, b.x + b.w);
+    auto bottom = std::max(a.y + a.h, b.y + b.h);
+    return ScreenRect{left, top, right - left, bottom - top};
+}
+
+ScreenRect toScreenRect(double x, double y, double width, double height,
+                        double widthFactor, double heightFactor)
+{
+    return ScreenRect{static_cast<int>(widthFactor * x),
+                      static_cast<int>(heightFactor * y),
+                      static_cast<int>(widthFactor * width),
+                      static_cast<int>(heightFactor * height)};
+}
+
+std::array<ScreenRect, 2> bevelHighlights(const ScreenRect& rect)
+{
+    return {ScreenRect{rect.x, rect.y, 2, rect.h + 1},
+            ScreenRect{rect.x, rect.y, rect.w + 1, 2}};
+}
+
+std::array<ScreenRect, 2> bevelShadows(const ScreenRect& rect)
+{
+    return {ScreenRect{rect.x, rect.y + rect.h - 1, rect.w + 1, 2},
+            ScreenRect{rect.x + rect.w - 1, rect.y, 2, rect.h + 1}};
+}
+
+ScreenRect withBevel(const ScreenRect& rect)
+{
+    return ScreenRect{rect.x, rect.y, rect.w + 1, rect.h + 1};
+}
+
+} // namespace bricks
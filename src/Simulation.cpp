@@ -0,0 +1,351 @@
+#include "Simulation.h"
+
+#include "game_objects/Physics.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <map>
+#include <utility>
+
+namespace bricks {
+
+using Brick = game_objects::Brick;
+
+using Angle = types::Angle;
+
+using Width = types::Width;
+using Velocity = types::Velocity;
+using Gravity = types::Gravity;
+
+constexpr int pointsPerBrickHitpoints{100};
+constexpr int pointsForExtraLife{10000};
+
+constexpr int maxBallContactsPerStep{8};
+
+constexpr double ballVelocityIncrease = 2.0;
+constexpr double ballGravityIncrease = 0.5;
+constexpr double platformVelocityIncrease = 2.0;
+constexpr double platformWidthDecrease = 0.5;
+
+constexpr double ballVelocityMax = 30.0;
+constexpr double ballGravityMax = 5.0;
+constexpr double platformVelocityMax = 28.0;
+constexpr double platformWidthMin = 2.0;
+
+Simulation::Simulation(std::vector<std::string> levelFilenames,
+                       long long highscore,
+                       const DifficultyParameters& difficultyParameters,
+                       std::uint64_t seed, double platformDeviation)
+    : Simulation{std::make_shared<LevelCache>(std::move(levelFilenames)),
+                 highscore, difficultyParameters, seed, platformDeviation}
+{
+}
+
+Simulation::Simulation(std::shared_ptr<LevelCache> levels, long long highscore,
+                       const DifficultyParameters& difficultyParameters,
+                       std::uint64_t seed, double platformDeviation)
+    : mStartDifficultyParameters{difficultyParameters},
+      mDifficultyParameters{difficultyParameters}, mLevels{std::move(levels)},
+      mLevel{mLevels->level(1)}, mRandom{seed},
+      mPlatformDeviation{platformDeviation}, mHighscore{highscore}
+{
+    mLevel.setDifficultyParameters(mDifficultyParameters);
+    prefetchNextLevel();
+}
+
+void Simulation::step(const InputHandler::Event& event, double elapsedTimeMS)
+{
+    if (!startStep(event, elapsedTimeMS)) {
+        return;
+    }
+    auto movedBall = mLevel.ball;
+    movedBall.move(elapsedTimeMS);
+    finishStep(elapsedTimeMS, movedBall.topLeft());
+}
+
+bool Simulation::startStep(const InputHandler::Event& event,
+                           double elapsedTimeMS)
+{
+    mSounds.clear();
+    mHitBricks.clear();
+    mStatusChanged = false;
+
+    if (mGameOver) {
+        return false;
+    }
+
+    mInputHandler.handleEvent(event, elapsedTimeMS, mLevel);
+    if (mInputHandler.isQuit() || mInputHandler.isPaused()) {
+        return false;
+    }
+    return mLevel.ball.isActive();
+}
+
+void Simulation::finishStep(double elapsedTimeMS, const types::Point& ballEnd)
+{
+    moveBall(elapsedTimeMS, ballEnd);
+
+    if (ballIsLost()) {
+        --mLifes;
+        mStatusChanged = true;
+        if (mLifes <= 0) {
+            emit(Sound::gameOver);
+            mHighscore = std::max(mHighscore, mScore);
+            mGameOver = true;
+            return;
+        }
+        emit(Sound::lostBall);
+        mLevel.resetBall();
+        mLevel.resetPlatform();
+    }
+
+    if (mLevel.allBricksDestroyed()) {
+        finishLevel();
+    }
+}
+
+void Simulation::restart()
+{
+    mLifes = mStartLifes;
+    mScore = 0;
+    mLastExtraLifeDivisor = 0;
+    mGameOver = false;
+    mDifficultyParameters = mStartDifficultyParameters;
+    changeLevel(1);
+}
+
+void Simulation::restart(std::uint64_t seed)
+{
+    mRandom.seed(seed);
+    restart();
+}
+
+const Level& Simulation::level() const
+{
+    return mLevel;
+}
+
+int Simulation::currentLevel() const
+{
+    return mCurrentLevelIDX;
+}
+
+int Simulation::lifes() const
+{
+    return mLifes;
+}
+
+long long Simulation::score() const
+{
+    return mScore;
+}
+
+long long Simulation::highscore() const
+{
+    return mHighscore;
+}
+
+int Simulation::playthroughs() const
+{
+    return mPlaythroughs;
+}
+
+bool Simulation::isPaused() const
+{
+    return mInputHandler.isPaused();
+}
+
+bool Simulation::changedPauseState() const
+{
+    return mInputHandler.changedPauseState();
+}
+
+bool Simulation::isQuit() const
+{
+    return mInputHandler.isQuit();
+}
+
+bool Simulation::isGameOver() const
+{
+    return mGameOver;
+}
+
+bool Simulation::statusChanged() const
+{
+    return mStatusChanged;
+}
+
+const std::vector<Sound>& Simulation::sounds() const
+{
+    return mSounds;
+}
+
+const std::vector<std::size_t>& Simulation::hitBricks() const
+{
+    return mHitBricks;
+}
+
+void Simulation::finishLevel()
+{
+    if (allLevelsFinished()) {
+        emit(Sound::winGame);
+        ++mPlaythroughs;
+        increaseDifficulty();
+        changeLevel(1);
+    }
+    else {
+        emit(Sound::nextLevel);
+        changeLevel(mCurrentLevelIDX + 1);
+    }
+}
+
+void Simulation::changeLevel(int levelIDX)
+{
+    if (levelIDX == mCurrentLevelIDX) {
+        mLevel.reset();
+    }
+    else {
+        mCurrentLevelIDX = levelIDX;
+        mLevel = mLevels->level(mCurrentLevelIDX);
+        prefetchNextLevel();
+    }
+    mLevel.setDifficultyParameters(mDifficultyParameters);
+    mStatusChanged = true;
+}
+
+void Simulation::prefetchNextLevel()
+{
+    mLevels->prefetch(allLevelsFinished() ? 1 : mCurrentLevelIDX + 1);
+}
+
+bool Simulation::allLevelsFinished() const
+{
+    return mCurrentLevelIDX >= static_cast<int>(mLevels->size());
+}
+
+void Simulation::increaseDifficulty()
+{
+    double platformVelocity = mDifficultyParameters.getPlatformVelocity()();
+    double platformWidth = mDifficultyParameters.getPlatformWidth()();
+    double ballVelocity = mDifficultyParameters.getBallVelocity()();
+    double ballGravity = mDifficultyParameters.getBallGravity()();
+
+    platformVelocity = std::clamp(platformVelocity + platformVelocityIncrease,
+                                  platformVelocity, platformVelocityMax);
+    platformWidth = std::clamp(platformWidth - platformWidthDecrease,
+                               platformWidthMin, platformWidth);
+    ballVelocity = std::clamp(ballVelocity + ballVelocityIncrease, ballVelocity,
+                              ballVelocityMax);
+    ballGravity = std::clamp(ballGravity + ballGravityIncrease, ballGravity,
+                             ballGravityMax);
+
+    mDifficultyParameters.setPlatformVelocity(Velocity{platformVelocity});
+    mDifficultyParameters.setPlatformWidth(Width{platformWidth});
+    mDifficultyParameters.setBallVelocity(Velocity{ballVelocity});
+    mDifficultyParameters.setBallGravity(Gravity{ballGravity});
+}
+
+bool Simulation::ballIsLost() const
+{
+    return mLevel.ball.bottomRight().y >= mLevel.gridHeight();
+}
+
+void Simulation::moveBall(double elapsedTimeMS, const types::Point& end)
+{
+    auto remainingTimeMS = elapsedTimeMS;
+    for (int contact = 0;
+         contact < maxBallContactsPerStep && remainingTimeMS > 0.0; ++contact) {
+        if (contact == 0) {
+            remainingTimeMS = game_objects::moveToFirstContact(
+                mLevel.ball, remainingTimeMS, end, mLevel.walls(),
+                mLevel.indestructibleBricks, mLevel.bricks, mLevel.brickGrid,
+                mLevel.platform);
+        }
+        else {
+            // After a contact the ball was reflected, so its way changed
+            remainingTimeMS = game_objects::moveToFirstContact(
+                mLevel.ball, remainingTimeMS, mLevel.walls(),
+                mLevel.indestructibleBricks, mLevel.bricks, mLevel.brickGrid,
+                mLevel.platform);
+        }
+        handleBallCollisions();
+    }
+}
+
+void Simulation::handleBallCollisions()
+{
+    mLevel.reflectBall(mHits);
+
+    for (const auto& hit : mHits) {
+        if (hit.kind != game_objects::ObjectKind::brick) {
+            continue;
+        }
+        mHitBricks.push_back(hit.index);
+        const auto& brick = mLevel.bricks[hit.index];
+        if (brick.isDestroyed()) {
+            emit(Sound::destroyBrick);
+            mScore += getBrickScore(brick);
+            awardExtraLifeIfThresholdReached();
+            mStatusChanged = true;
+        }
+        else {
+            emit(Sound::hitBrick);
+        }
+    }
+
+    auto reflected =
+        mPlatformDeviation > 0.0
+            ? game_objects::reflectFromPlatform(
+                  mLevel.ball, mLevel.platform, mRandom,
+                  Angle{static_cast<types::Real>(mPlatformDeviation)})
+            : game_objects::reflectFromPlatform(mLevel.ball, mLevel.platform);
+    if (reflected) {
+        emit(Sound::hitPlatform);
+    }
+}
+
+long long Simulation::getBrickScore(const Brick& brick) const
+{
+    return pointsPerBrickHitpoints * brick.startHitpoints() * mCurrentLevelIDX;
+}
+
+void Simulation::awardExtraLifeIfThresholdReached()
+{
+    auto extraLifeDivisor = static_cast<long long>(mScore / pointsForExtraLife);
+    if (extraLifeDivisor != mLastExtraLifeDivisor) {
+        emit(Sound::extraLife);
+        ++mLifes;
+        mLastExtraLifeDivisor = extraLifeDivisor;
+    }
+}
+
+void Simulation::emit(Sound sound)
+{
+    mSounds.push_back(sound);
+}
+
+std::vector<std::string>
+getLevelFilenamesFromFolder(const std::string& folderName)
+{
+    // A binary level replaces the text level with the same name
+    std::map<std::filesystem::path, std::filesystem::path> levels;
+    for (auto& p : std::filesystem::directory_iterator(folderName)) {
+        auto extension = p.path().extension();
+        auto stem = p.path();
+        stem.replace_extension();
+        if (extension == ".blvl") {
+            levels[stem] = p.path();
+        }
+        else if (extension == ".lvl") {
+            levels.emplace(stem, p.path());
+        }
+    }
+    std::vector<std::string> names;
+    for (const auto& level : levels) {
+        names.emplace_back(std::filesystem::absolute(level.second));
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+} // namespace bricks
@@ -0,0 +1,140 @@
+#include "SoftwareRenderer.h"
+
+#include "Level.h"
+
+#include "game_objects/BrickColumns.h"
+
+#include <cassert>
+
+namespace bricks {
+
+using BrickColumns = game_objects::BrickColumns;
+using GameObject = game_objects::GameObject;
+using Point = types::Point;
+
+SoftwareRenderer::SoftwareRenderer(std::size_t screenWidth,
+                                   std::size_t screenHeight,
+                                   std::size_t gridWidth,
+                                   std::size_t gridHeight)
+    : mFrame{static_cast<int>(screenWidth), static_cast<int>(screenHeight)},
+      mWidthFactor{static_cast<double>(screenWidth) /
+                   static_cast<double>(gridWidth)},
+      mHeightFactor{static_cast<double>(screenHeight) /
+                    static_cast<double>(gridHeight)}
+{
+}
+
+void SoftwareRenderer::render(const Level& level)
+{
+    render(level, level.ball.topLeft(), level.platform.topLeft());
+}
+
+void SoftwareRenderer::render(const Level& level, const Point& ballTopLeft,
+                              const Point& platformTopLeft)
+{
+    auto ball = level.ball;
+    ball.setTopLeft(ballTopLeft);
+    auto platform = level.platform;
+    platform.setTopLeft(platformTopLeft);
+
+    mFrame.clear(
+        toPixel(mPalette.object(PaletteObject::background, mPaused).base));
+
+    const auto& wallShades = mPalette.object(PaletteObject::wall, mPaused);
+    for (const auto& wall : level.walls()) {
+        render(wall, wallShades);
+    }
+    const auto& indestructibleBrickShades =
+        mPalette.object(PaletteObject::indestructibleBrick, mPaused);
+    for (const auto& indestructibleBrick : level.indestructibleBricks) {
+        render(indestructibleBrick, indestructibleBrickShades);
+    }
+    render(level.brickGrid.columns());
+
+    render(ball, mPalette.object(PaletteObject::ball, mPaused));
+    render(platform, mPalette.object(PaletteObject::platform, mPaused));
+}
+
+void SoftwareRenderer::setPaused(bool paused)
+{
+    mPaused = paused;
+}
+
+const FrameBuffer& SoftwareRenderer::frame() const
+{
+    return mFrame;
+}
+
+void SoftwareRenderer::render(const BrickColumns& brickColumns)
+{
+    const auto& hitpoints = brickColumns.hitpoints();
+
+    for (auto& rects : mBrickRects) {
+        rects.clear();
+    }
+    for (std::size_t i = 0; i < brickColumns.size(); ++i) {
+        if (hitpoints[i] <= 0) {
+            continue;
+        }
+        assert(hitpoints[i] <= Palette::maxBrickHitpoints);
+        mBrickRects[static_cast<std::size_t>(hitpoints[i] - 1)].push_back(
+            bricks::toScreenRect(brickColumns.x()[i], brickColumns.y()[i],
+                                 brickColumns.width()[i],
+                                 brickColumns.height()[i], mWidthFactor,
+                                 mHeightFactor));
+    }
+
+    // Same order as Renderer, all fills before all bevels.
+    for (std::size_t i = 0; i < mBrickRects.size(); ++i) {
+        auto pixel = toPixel(
+            mPalette.brick(static_cast<int>(i) + 1, mPaused).base);
+        for (const auto& rect : mBrickRects[i]) {
+            mFrame.fillRect(rect, pixel);
+        }
+    }
+    for (std::size_t i = 0; i < mBrickRects.size(); ++i) {
+        auto pixel = toPixel(
+            mPalette.brick(static_cast<int>(i) + 1, mPaused).lighter);
+        for (const auto& rect : mBrickRects[i]) {
+            for (const auto& highlight : bevelHighlights(rect)) {
+                mFrame.fillRect(highlight, pixel);
+            }
+        }
+    }
+    for (std::size_t i = 0; i < mBrickRects.size(); ++i) {
+        auto pixel = toPixel(
+            mPalette.brick(static_cast<int>(i) + 1, mPaused).darker);
+        for (const auto& rect : mBrickRects[i]) {
+            for (const auto& shadow : bevelShadows(rect)) {
+                mFrame.fillRect(shadow, pixel);
+            }
+        }
+    }
+}
+
+void SoftwareRenderer::render(const GameObject& obj, const Shades& shades)
+{
+    render(toScreenRect(obj), shades);
+}
+
+void SoftwareRenderer::render(const ScreenRect& rect, const Shades& shades)
+{
+    mFrame.fillRect(rect, toPixel(shades.base));
+    auto lighter = toPixel(shades.lighter);
+    for (const auto& highlight : bevelHighlights(rect)) {
+        mFrame.fillRect(highlight, lighter);
+    }
+    auto darker = toPixel(shades.darker);
+    for (const auto& shadow : bevelShadows(rect)) {
+        mFrame.fillRect(shadow, darker);
+    }
+}
+
+ScreenRect SoftwareRenderer::toScreenRect(const GameObject& obj) const
+{
+    auto p = obj.topLeft();
+    return bricks::toScreenRect(p.x, p.y, obj.width(), obj.height(),
+                                mWidthFactor, mHeightFactor);
+}
+
+} // namespace bricks
@@ -0,0 +1,35 @@
+#include "SoundQueue.h"
+
+namespace bricks {
+
+bool SoundQueue::push(Sound sound)
+{
+    auto pushPosition = mPushPosition.load(std::memory_order_relaxed);
+    auto popPosition = mPopPosition.load(std::memory_order_acquire);
+    if (pushPosition - popPosition == capacity) {
+        return false;
+    }
+    mSounds[pushPosition & (capacity - 1)] = sound;
+    mPushPosition.store(pushPosition + 1, std::memory_order_release);
+    return true;
+}
+
+std::optional<Sound> SoundQueue::pop()
+{
+    auto popPosition = mPopPosition.load(std::memory_order_relaxed);
+    auto pushPosition = mPushPosition.load(std::memory_order_acquire);
+    if (popPosition == pushPosition) {
+        return std::nullopt;
+    }
+    auto sound = mSounds[popPosition & (capacity - 1)];
+    mPopPosition.store(popPosition + 1, std::memory_order_release);
+    return sound;
+}
+
+bool SoundQueue::empty() const
+{
+    return mPopPosition.load(std::memory_order_acquire) ==
+           mPushPosition.load(std::memory_order_acquire);
+}
+
+} // namespace bricks
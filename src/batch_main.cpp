@@ -0,0 +1,54 @@
+#include "BatchRunner.h"
+#include "Simulation.h"
+
+#include "utility/ThreadPool.h"
+#include "utility/TimeMeasure.h"
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+
+int main(int argc, char* argv[])
+{
+    try {
+        int games = argc > 1 ? std::stoi(argv[1]) : 100;
+        bricks::BatchSettings settings;
+        settings.maxTicks = argc > 2 ? std::stoll(argv[2]) : 100000;
+        auto threads = argc > 3 ? static_cast<std::size_t>(std::stoul(argv[3]))
+                                : std::thread::hardware_concurrency();
+
+        auto levelFilenames = bricks::getLevelFilenamesFromFolder("level");
+
+        std::vector<bricks::BatchJob> jobs(static_cast<std::size_t>(games));
+        for (std::size_t i = 0; i < jobs.size(); ++i) {
+            jobs[i].seed = i;
+        }
+
+        bricks::utility::ThreadPool pool{threads};
+        auto start = bricks::utility::getCurrentTime();
+        auto result = bricks::runBatch(levelFilenames, jobs, settings, pool);
+        auto elapsedMS = bricks::utility::getElapsedTime(
+            start, bricks::utility::getCurrentTime());
+
+        std::cout << result.games << " games (" << result.gameOvers
+                  << " game over), " << result.ticks << " ticks in "
+                  << elapsedMS << " ms on " << pool.threadCount()
+                  << " threads\n";
+        std::cout << "level  starts  completions  lost balls  avg ticks"
+                     "  avg score\n";
+        for (std::size_t i = 0; i < result.levels.size(); ++i) {
+            const auto& level = result.levels[i];
+            auto starts = static_cast<double>(std::max(level.starts, 1LL));
+            std::cout << std::setw(5) << i + 1 << std::setw(8) << level.starts
+                      << std::setw(13) << level.completions << std::setw(12)
+                      << level.lostBalls << std::setw(11) << std::fixed
+                      << std::setprecision(1) << level.ticks / starts
+                      << std::setw(11) << level.score / starts << '\n';
+        }
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+}
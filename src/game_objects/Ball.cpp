@@ -3,6 +3,8 @@
 #include "../utility/NearlyEqual.h"
 #include "../utility/OperatorDegree.h"
 
+#include <cmath>
+
 namespace bricks::game_objects {
 
 using namespace utility;
@@ -94,16 +96,23 @@ double calcTraveldWay(double deltaTimeMS, double velocityInS)
 }
 
 Point calcDelta(Angle angle, double sideC)
+{
+    return calcDelta(angle.quadrant(), angle.quadrantAngle(), sideC);
+}
+
+template <typename Precision>
+Point calcDelta(Quadrant quadrant, Precision quadrantAngle, double sideC)
 {
     if (nearlyEqual(sideC, 0.0)) {
         return Point{0, 0};
     }
 
-    auto sideA = sin(angle.quadrantAngle()) * sideC;
-    auto sideB = cos(angle.quadrantAngle()) * sideC;
+    auto side = static_cast<Precision>(sideC);
+    auto sideA = static_cast<double>(std::sin(quadrantAngle) * side);
+    auto sideB = static_cast<double>(std::cos(quadrantAngle) * side);
 
     Point ret;
-    switch (angle.quadrant()) {
+    switch (quadrant) {
     case Quadrant::I:
         ret.x = sideB;
         ret.y = sideA;
@@ -123,6 +132,13 @@ Point calcDelta(Angle angle, double sideC)
     }
     return ret;
 }
+
+template Point calcDelta<float>(Quadrant quadrant, float quadrantAngle,
+                                double sideC);
+template Point calcDelta<double>(Quadrant quadrant, double quadrantAngle,
+                                 double sideC);
+template Point calcDelta<long double>(Quadrant quadrant,
+                                      long double quadrantAngle, double sideC);
 } // namespace impl
 
 } // namespace bricks::game_objects
\ No newline at end of file
@@ -0,0 +1,324 @@
+#include "BallBatch.h"
+
+#include "Ball.h"
+
+#include "../utility/OperatorDegree.h"
+
+#include <cassert>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace bricks::game_objects {
+
+using namespace utility;
+
+using Angle = types::Angle;
+using Point = types::Point;
+
+namespace {
+
+using MoveColumnsD = impl::MoveColumns<double>;
+using MoveColumnsF = impl::MoveColumns<float>;
+
+// Ball::move moves with gravity in this direction
+const Point gravityDirection = impl::calcDelta(Angle{90.0_deg}, 1.0);
+
+// Moves as many balls as fit into full SIMD registers from first on and
+// returns the index of the first ball left for impl::moveScalar.
+// Every step is a separate multiply and add like in Ball::move, so the
+// positions are the same.
+std::size_t moveLanes(const MoveColumnsD& columns, double elapsedTimeInS,
+                      std::size_t first, std::size_t last)
+{
+    auto i = first;
+#if defined(__AVX__)
+    auto time = _mm256_set1_pd(elapsedTimeInS);
+    auto gravityX = _mm256_set1_pd(gravityDirection.x);
+    auto gravityY = _mm256_set1_pd(gravityDirection.y);
+    for (; i + 4 <= last; i += 4) {
+        auto way = _mm256_mul_pd(_mm256_loadu_pd(&columns.velocity[i]), time);
+        auto fall = _mm256_mul_pd(_mm256_loadu_pd(&columns.gravity[i]), time);
+        auto x = _mm256_add_pd(
+            _mm256_loadu_pd(&columns.x[i]),
+            _mm256_mul_pd(_mm256_loadu_pd(&columns.directionX[i]), way));
+        auto y = _mm256_add_pd(
+            _mm256_loadu_pd(&columns.y[i]),
+            _mm256_mul_pd(_mm256_loadu_pd(&columns.directionY[i]), way));
+        _mm256_storeu_pd(&columns.x[i],
+                         _mm256_add_pd(x, _mm256_mul_pd(gravityX, fall)));
+        _mm256_storeu_pd(&columns.y[i],
+                         _mm256_add_pd(y, _mm256_mul_pd(gravityY, fall)));
+    }
+#elif defined(__SSE2__)
+    auto time = _mm_set1_pd(elapsedTimeInS);
+    auto gravityX = _mm_set1_pd(gravityDirection.x);
+    auto gravityY = _mm_set1_pd(gravityDirection.y);
+    for (; i + 2 <= last; i += 2) {
+        auto way = _mm_mul_pd(_mm_loadu_pd(&columns.velocity[i]), time);
+        auto fall = _mm_mul_pd(_mm_loadu_pd(&columns.gravity[i]), time);
+        auto x = _mm_add_pd(
+            _mm_loadu_pd(&columns.x[i]),
+            _mm_mul_pd(_mm_loadu_pd(&columns.directionX[i]), way));
+        auto y = _mm_add_pd(
+            _mm_loadu_pd(&columns.y[i]),
+            _mm_mul_pd(_mm_loadu_pd(&columns.directionY[i]), way));
+        _mm_storeu_pd(&columns.x[i], _mm_add_pd(x, _mm_mul_pd(gravityX, fall)));
+        _mm_storeu_pd(&columns.y[i], _mm_add_pd(y, _mm_mul_pd(gravityY, fall)));
+    }
+#endif
+    return i;
+}
+
+std::size_t moveLanes(const MoveColumnsF& columns, float elapsedTimeInS,
+                      std::size_t first, std::size_t last)
+{
+    auto i = first;
+#if defined(__AVX__)
+    auto time = _mm256_set1_ps(elapsedTimeInS);
+    auto gravityX = _mm256_set1_ps(static_cast<float>(gravityDirection.x));
+    auto gravityY = _mm256_set1_ps(static_cast<float>(gravityDirection.y));
+    for (; i + 8 <= last; i += 8) {
+        auto way = _mm256_mul_ps(_mm256_loadu_ps(&columns.velocity[i]), time);
+        auto fall = _mm256_mul_ps(_mm256_loadu_ps(&columns.gravity[i]), time);
+        auto x = _mm256_add_ps(
+            _mm256_loadu_ps(&columns.x[i]),
+            _mm256_mul_ps(_mm256_loadu_ps(&columns.directionX[i]), way));
+        auto y = _mm256_add_ps(
+            _mm256_loadu_ps(&columns.y[i]),
+            _mm256_mul_ps(_mm256_loadu_ps(&columns.directionY[i]), way));
+        _mm256_storeu_ps(&columns.x[i],
+                         _mm256_add_ps(x, _mm256_mul_ps(gravityX, fall)));
+        _mm256_storeu_ps(&columns.y[i],
+                         _mm256_add_ps(y, _mm256_mul_ps(gravityY, fall)));
+    }
+#elif defined(__SSE2__)
+    auto time = _mm_set1_ps(elapsedTimeInS);
+    auto gravityX = _mm_set1_ps(static_cast<float>(gravityDirection.x));
+    auto gravityY = _mm_set1_ps(static_cast<float>(gravityDirection.y));
+    for (; i + 4 <= last; i += 4) {
+        auto way = _mm_mul_ps(_mm_loadu_ps(&columns.velocity[i]), time);
+        auto fall = _mm_mul_ps(_mm_loadu_ps(&columns.gravity[i]), time);
+        auto x = _mm_add_ps(
+            _mm_loadu_ps(&columns.x[i]),
+            _mm_mul_ps(_mm_loadu_ps(&columns.directionX[i]), way));
+        auto y = _mm_add_ps(
+            _mm_loadu_ps(&columns.y[i]),
+            _mm_mul_ps(_mm_loadu_ps(&columns.directionY[i]), way));
+        _mm_storeu_ps(&columns.x[i], _mm_add_ps(x, _mm_mul_ps(gravityX, fall)));
+        _mm_storeu_ps(&columns.y[i], _mm_add_ps(y, _mm_mul_ps(gravityY, fall)));
+    }
+#endif
+    return i;
+}
+
+} // namespace
+
+template <typename Real>
+std::size_t BallBatch<Real>::size() const
+{
+    return mX.size();
+}
+
+template <typename Real>
+std::size_t BallBatch<Real>::add(const Ball& ball)
+{
+    mX.emplace_back();
+    mY.emplace_back();
+    mAngle.emplace_back();
+    mVelocity.emplace_back();
+    mGravity.emplace_back();
+    mIsActive.emplace_back();
+    mDirectionAngle.emplace_back();
+    mDirectionX.emplace_back();
+    mDirectionY.emplace_back();
+    mMoveVelocity.emplace_back();
+    mMoveGravity.emplace_back();
+
+    auto index = size() - 1;
+    set(index, ball);
+    updateDirection(index, ball.angle());
+    return index;
+}
+
+template <typename Real>
+void BallBatch<Real>::set(std::size_t index, const Ball& ball)
+{
+    assert(index < size());
+    mX[index] = static_cast<Real>(ball.topLeft().x);
+    mY[index] = static_cast<Real>(ball.topLeft().y);
+    mVelocity[index] = static_cast<Real>(ball.velocity());
+    mGravity[index] = static_cast<Real>(ball.gravity());
+    mIsActive[index] = ball.isActive() ? 1 : 0;
+    updateMoveVelocity(index);
+
+    const auto& angle = ball.angle();
+    const auto& directionAngle = mDirectionAngle[index];
+    if (angle.quadrant() != directionAngle.quadrant() ||
+        angle.quadrantAngle() != directionAngle.quadrantAngle()) {
+        updateDirection(index, angle);
+    }
+}
+
+template <typename Real>
+void BallBatch<Real>::copyTopLeftTo(std::size_t index, Ball& ball) const
+{
+    ball.setTopLeft(topLeft(index));
+}
+
+template <typename Real>
+Point BallBatch<Real>::topLeft(std::size_t index) const
+{
+    assert(index < size());
+    return Point{static_cast<double>(mX[index]),
+                 static_cast<double>(mY[index])};
+}
+
+template <typename Real>
+void BallBatch<Real>::setTopLeft(std::size_t index, const Point& topLeft)
+{
+    assert(index < size());
+    mX[index] = static_cast<Real>(topLeft.x);
+    mY[index] = static_cast<Real>(topLeft.y);
+}
+
+template <typename Real>
+void BallBatch<Real>::setAngle(std::size_t index, Real angle)
+{
+    assert(index < size());
+    updateDirection(index, Angle{static_cast<types::Real>(angle)});
+}
+
+template <typename Real>
+void BallBatch<Real>::setVelocity(std::size_t index, Real velocity)
+{
+    assert(index < size());
+    mVelocity[index] = velocity;
+    updateMoveVelocity(index);
+}
+
+template <typename Real>
+void BallBatch<Real>::setGravity(std::size_t index, Real gravity)
+{
+    assert(index < size());
+    mGravity[index] = gravity;
+    updateMoveVelocity(index);
+}
+
+template <typename Real>
+bool BallBatch<Real>::isActive(std::size_t index) const
+{
+    assert(index < size());
+    return mIsActive[index] != 0;
+}
+
+template <typename Real>
+void BallBatch<Real>::activate(std::size_t index)
+{
+    assert(index < size());
+    mIsActive[index] = 1;
+    updateMoveVelocity(index);
+}
+
+template <typename Real>
+const std::vector<Real>& BallBatch<Real>::x() const
+{
+    return mX;
+}
+
+template <typename Real>
+const std::vector<Real>& BallBatch<Real>::y() const
+{
+    return mY;
+}
+
+template <typename Real>
+const std::vector<Real>& BallBatch<Real>::angle() const
+{
+    return mAngle;
+}
+
+template <typename Real>
+const std::vector<Real>& BallBatch<Real>::velocity() const
+{
+    return mVelocity;
+}
+
+template <typename Real>
+const std::vector<Real>& BallBatch<Real>::gravity() const
+{
+    return mGravity;
+}
+
+template <typename Real>
+void BallBatch<Real>::move(double elapsedTimeInMS)
+{
+    move(elapsedTimeInMS, 0, size());
+}
+
+template <typename Real>
+void BallBatch<Real>::move(double elapsedTimeInMS, std::size_t first,
+                           std::size_t last)
+{
+    assert(first <= last && last <= size());
+    // Like impl::calcTraveldWay
+    auto elapsedTimeInS = static_cast<Real>(elapsedTimeInMS / 1000.0);
+    impl::MoveColumns<Real> columns{
+        mX.data(),          mY.data(),            mDirectionX.data(),
+        mDirectionY.data(), mMoveVelocity.data(), mMoveGravity.data()};
+    first = moveLanes(columns, elapsedTimeInS, first, last);
+    impl::moveScalar(columns, elapsedTimeInS, first, last);
+}
+
+template <typename Real>
+void BallBatch<Real>::updateDirection(std::size_t index, const Angle& angle)
+{
+    mAngle[index] = static_cast<Real>(angle.get());
+    mDirectionAngle[index] = angle;
+    auto direction = impl::calcDelta(angle, 1.0);
+    mDirectionX[index] = static_cast<Real>(direction.x);
+    mDirectionY[index] = static_cast<Real>(direction.y);
+}
+
+template <typename Real>
+void BallBatch<Real>::updateMoveVelocity(std::size_t index)
+{
+    auto isActive = mIsActive[index] != 0;
+    mMoveVelocity[index] = isActive ? mVelocity[index] : Real{0};
+    mMoveGravity[index] = isActive ? mGravity[index] : Real{0};
+}
+
+template class BallBatch<float>;
+template class BallBatch<double>;
+
+namespace impl {
+
+template <typename Real>
+void moveScalar(const MoveColumns<Real>& columns, Real elapsedTimeInS,
+                std::size_t first, std::size_t last)
+{
+    auto gravityX = static_cast<Real>(gravityDirection.x);
+    auto gravityY = static_cast<Real>(gravityDirection.y);
+    for (auto i = first; i < last; ++i) {
+        auto way = columns.velocity[i] * elapsedTimeInS;
+        auto fall = columns.gravity[i] * elapsedTimeInS;
+        auto x = columns.x[i] + columns.directionX[i] * way;
+        auto y = columns.y[i] + columns.directionY[i] * way;
+        columns.x[i] = x + gravityX * fall;
+        columns.y[i] = y + gravityY * fall;
+    }
+}
+
+template void moveScalar(const MoveColumns<float>& columns,
+                         float elapsedTimeInS, std::size_t first,
+                         std::size_t last);
+template void moveScalar(const MoveColumns<double>& columns,
+                         double elapsedTimeInS, std::size_t first,
+                         std::size_t last);
+
+} // namespace impl
+
+} // namespace bricks::game_objects
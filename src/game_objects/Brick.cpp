@@ -41,6 +41,11 @@ bool Brick::isDestroyed() const
     return mHitpoints == 0;
 }
 
+void Brick::resetHitpoints()
+{
+    mHitpoints = mStartHitpoints;
+}
+
 int Brick::checkArgs(int hitpoints)
 {
     if (hitpoints < 1 || hitpoints > 9) {
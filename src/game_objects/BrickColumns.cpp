@@ -0,0 +1,169 @@
+#include "BrickColumns.h"
+
+#include "Brick.h"
+
+#include <cassert>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace bricks::game_objects {
+
+using Point = types::Point;
+
+BrickColumns::BrickColumns(const std::vector<Brick>& bricks)
+{
+    mX.reserve(bricks.size());
+    mY.reserve(bricks.size());
+    mWidth.reserve(bricks.size());
+    mHeight.reserve(bricks.size());
+    mHitpoints.reserve(bricks.size());
+
+    for (const auto& brick : bricks) {
+        mX.push_back(brick.topLeft().x);
+        mY.push_back(brick.topLeft().y);
+        mWidth.push_back(brick.width());
+        mHeight.push_back(brick.height());
+        mHitpoints.push_back(brick.hitpoints());
+    }
+}
+
+std::size_t BrickColumns::size() const
+{
+    return mHitpoints.size();
+}
+
+const std::vector<double>& BrickColumns::x() const
+{
+    return mX;
+}
+
+const std::vector<double>& BrickColumns::y() const
+{
+    return mY;
+}
+
+const std::vector<double>& BrickColumns::width() const
+{
+    return mWidth;
+}
+
+const std::vector<double>& BrickColumns::height() const
+{
+    return mHeight;
+}
+
+const std::vector<int>& BrickColumns::hitpoints() const
+{
+    return mHitpoints;
+}
+
+void BrickColumns::setHitpoints(std::size_t brickIndex, int hitpoints)
+{
+    assert(brickIndex < mHitpoints.size());
+    mHitpoints[brickIndex] = hitpoints;
+}
+
+void BrickColumns::sweep(const Point& topLeft, const Point& bottomRight,
+                         std::vector<std::size_t>& indices) const
+{
+    indices.clear();
+    std::size_t i = 0;
+
+#if defined(__AVX__)
+    auto left = _mm256_set1_pd(topLeft.x);
+    auto top = _mm256_set1_pd(topLeft.y);
+    auto right = _mm256_set1_pd(bottomRight.x);
+    auto bottom = _mm256_set1_pd(bottomRight.y);
+    auto zero = _mm_setzero_si128();
+
+    for (; i + 4 <= size(); i += 4) {
+        auto x = _mm256_loadu_pd(&mX[i]);
+        auto y = _mm256_loadu_pd(&mY[i]);
+        auto xRight = _mm256_add_pd(x, _mm256_loadu_pd(&mWidth[i]));
+        auto yBottom = _mm256_add_pd(y, _mm256_loadu_pd(&mHeight[i]));
+
+        auto overlaps = _mm256_and_pd(
+            _mm256_and_pd(_mm256_cmp_pd(x, right, _CMP_LE_OQ),
+                          _mm256_cmp_pd(left, xRight, _CMP_LE_OQ)),
+            _mm256_and_pd(_mm256_cmp_pd(y, bottom, _CMP_LE_OQ),
+                          _mm256_cmp_pd(top, yBottom, _CMP_LE_OQ)));
+
+        auto hitpoints = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(&mHitpoints[i]));
+        auto alive = _mm_movemask_ps(
+            _mm_castsi128_ps(_mm_cmpgt_epi32(hitpoints, zero)));
+
+        auto mask = _mm256_movemask_pd(overlaps) & alive;
+        for (std::size_t lane = 0; mask != 0; ++lane, mask >>= 1) {
+            if ((mask & 1) != 0) {
+                indices.push_back(i + lane);
+            }
+        }
+    }
+#elif defined(__SSE2__)
+    auto left = _mm_set1_pd(topLeft.x);
+    auto top = _mm_set1_pd(topLeft.y);
+    auto right = _mm_set1_pd(bottomRight.x);
+    auto bottom = _mm_set1_pd(bottomRight.y);
+    auto zero = _mm_setzero_si128();
+
+    for (; i + 2 <= size(); i += 2) {
+        auto x = _mm_loadu_pd(&mX[i]);
+        auto y = _mm_loadu_pd(&mY[i]);
+        auto xRight = _mm_add_pd(x, _mm_loadu_pd(&mWidth[i]));
+        auto yBottom = _mm_add_pd(y, _mm_loadu_pd(&mHeight[i]));
+
+        auto overlaps =
+            _mm_and_pd(_mm_and_pd(_mm_cmple_pd(x, right),
+                                  _mm_cmple_pd(left, xRight)),
+                       _mm_and_pd(_mm_cmple_pd(y, bottom),
+                                  _mm_cmple_pd(top, yBottom)));
+
+        auto hitpoints = _mm_loadl_epi64(
+            reinterpret_cast<const __m128i*>(&mHitpoints[i]));
+        auto alive = _mm_cmpgt_epi32(hitpoints, zero);
+        alive = _mm_unpacklo_epi32(alive, alive);
+
+        auto mask =
+            _mm_movemask_pd(_mm_and_pd(overlaps, _mm_castsi128_pd(alive)));
+        if ((mask & 1) != 0) {
+            indices.push_back(i);
+        }
+        if ((mask & 2) != 0) {
+            indices.push_back(i + 1);
+        }
+    }
+#endif
+
+    impl::sweepScalar(*this, topLeft, bottomRight, i, indices);
+}
+
+namespace impl {
+
+void sweepScalar(const BrickColumns& columns, const Point& topLeft,
+                 const Point& bottomRight, std::size_t first,
+                 std::vector<std::size_t>& indices)
+{
+    const auto& x = columns.x();
+    const auto& y = columns.y();
+    const auto& width = columns.width();
+    const auto& height = columns.height();
+    const auto& hitpoints = columns.hitpoints();
+
+    for (auto i = first; i < columns.size(); ++i) {
+        auto xOverlaps = x[i] <= bottomRight.x && topLeft.x <= x[i] + width[i];
+        auto yOverlaps =
+            y[i] <= bottomRight.y && topLeft.y <= y[i] + height[i];
+        if (xOverlaps && yOverlaps && hitpoints[i] > 0) {
+            indices.push_back(i);
+        }
+    }
+}
+
+} // namespace impl
+
+} // namespace bricks::game_objects
@@ -0,0 +1,174 @@
+#include "BrickGrid.h"
+
+#include "Brick.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace bricks::game_objects {
+
+using Point = types::Point;
+
+BrickGrid::BrickGrid(int gridWidth, int gridHeight,
+                     const std::vector<Brick>& bricks)
+    : mWidth{gridWidth}, mHeight{gridHeight},
+      mCellStarts(static_cast<std::size_t>(gridWidth * gridHeight) + 1, 0),
+      mCellSizes(static_cast<std::size_t>(gridWidth * gridHeight), 0),
+      mColumns{bricks}, mVisitedStamps(bricks.size(), 0)
+{
+    assert(mWidth > 0);
+    assert(mHeight > 0);
+
+    fillCells(bricks);
+}
+
+int BrickGrid::width() const
+{
+    return mWidth;
+}
+
+int BrickGrid::height() const
+{
+    return mHeight;
+}
+
+const BrickColumns& BrickGrid::columns() const
+{
+    return mColumns;
+}
+
+void BrickGrid::update(std::size_t brickIndex, const Brick& brick)
+{
+    if (brick.isDestroyed()) {
+        remove(brickIndex, brick);
+        return;
+    }
+    if (mCellSizes.empty()) {
+        return;
+    }
+    mColumns.setHitpoints(brickIndex, brick.hitpoints());
+}
+
+void BrickGrid::remove(std::size_t brickIndex, const Brick& brick)
+{
+    if (mCellSizes.empty()) {
+        return;
+    }
+    mColumns.setHitpoints(brickIndex, 0);
+    auto range = cellRange(brick.topLeft(), brick.bottomRight());
+    for (int y = range.top; y <= range.bottom; ++y) {
+        for (int x = range.left; x <= range.right; ++x) {
+            auto cellIdx = cell(x, y);
+            auto first = mCellIndices.begin() +
+                         static_cast<std::ptrdiff_t>(mCellStarts[cellIdx]);
+            auto last =
+                first + static_cast<std::ptrdiff_t>(mCellSizes[cellIdx]);
+            mCellSizes[cellIdx] = static_cast<std::size_t>(
+                std::remove(first, last, brickIndex) - first);
+        }
+    }
+}
+
+void BrickGrid::reset(const std::vector<Brick>& bricks)
+{
+    assert(bricks.size() == mColumns.size());
+    if (mCellSizes.empty()) {
+        return;
+    }
+    for (std::size_t i = 0; i < bricks.size(); ++i) {
+        mColumns.setHitpoints(i, bricks[i].hitpoints());
+    }
+    fillCells(bricks);
+}
+
+const std::vector<std::size_t>& BrickGrid::query(const Point& topLeft,
+                                                 const Point& bottomRight)
+{
+    mCandidates.clear();
+    if (mCellSizes.empty()) {
+        return mCandidates;
+    }
+
+    auto range = cellRange(topLeft, bottomRight);
+    auto cellCount = static_cast<std::size_t>(range.right - range.left + 1) *
+                     static_cast<std::size_t>(range.bottom - range.top + 1);
+    if (cellCount > mColumns.size()) {
+        mColumns.sweep(topLeft, bottomRight, mCandidates);
+        return mCandidates;
+    }
+
+    ++mStamp;
+    if (mStamp == 0) {
+        std::fill(mVisitedStamps.begin(), mVisitedStamps.end(), 0);
+        mStamp = 1;
+    }
+
+    for (int y = range.top; y <= range.bottom; ++y) {
+        for (int x = range.left; x <= range.right; ++x) {
+            auto cellIdx = cell(x, y);
+            auto first = mCellStarts[cellIdx];
+            auto last = first + mCellSizes[cellIdx];
+            for (auto i = first; i < last; ++i) {
+                auto index = mCellIndices[i];
+                if (mVisitedStamps[index] != mStamp) {
+                    mVisitedStamps[index] = mStamp;
+                    mCandidates.push_back(index);
+                }
+            }
+        }
+    }
+    std::sort(mCandidates.begin(), mCandidates.end());
+    return mCandidates;
+}
+
+BrickGrid::CellRange BrickGrid::cellRange(const Point& topLeft,
+                                          const Point& bottomRight) const
+{
+    // Truncating after clamping to >= 0 is the same as std::floor, but
+    // doesn't need a call into libm without SSE4.1
+    auto toCell = [](double value, int size) {
+        return static_cast<int>(
+            std::clamp(value, 0.0, static_cast<double>(size - 1)));
+    };
+    return CellRange{toCell(topLeft.x, mWidth), toCell(topLeft.y, mHeight),
+                     toCell(bottomRight.x, mWidth),
+                     toCell(bottomRight.y, mHeight)};
+}
+
+std::size_t BrickGrid::cell(int x, int y) const
+{
+    return static_cast<std::size_t>(y * mWidth + x);
+}
+
+void BrickGrid::fillCells(const std::vector<Brick>& bricks)
+{
+    auto forEachCoveredCell = [this, &bricks](auto func) {
+        for (std::size_t i = 0; i < bricks.size(); ++i) {
+            if (bricks[i].isDestroyed()) {
+                continue;
+            }
+            auto range =
+                cellRange(bricks[i].topLeft(), bricks[i].bottomRight());
+            for (int y = range.top; y <= range.bottom; ++y) {
+                for (int x = range.left; x <= range.right; ++x) {
+                    func(cell(x, y), i);
+                }
+            }
+        }
+    };
+
+    std::fill(mCellSizes.begin(), mCellSizes.end(), 0);
+    forEachCoveredCell(
+        [this](std::size_t cellIdx, std::size_t) { ++mCellSizes[cellIdx]; });
+    for (std::size_t i = 0; i < mCellSizes.size(); ++i) {
+        mCellStarts[i + 1] = mCellStarts[i] + mCellSizes[i];
+    }
+    mCellIndices.resize(mCellStarts.back());
+    std::fill(mCellSizes.begin(), mCellSizes.end(), 0);
+    forEachCoveredCell([this](std::size_t cellIdx, std::size_t brickIdx) {
+        mCellIndices[mCellStarts[cellIdx] + mCellSizes[cellIdx]++] = brickIdx;
+    });
+}
+
+} // namespace bricks::game_objects
@@ -2,6 +2,7 @@
 
 #include "Ball.h"
 #include "Brick.h"
+#include "BrickGrid.h"
 #include "GameObject.h"
 #include "IndestructibleBrick.h"
 #include "Platform.h"
@@ -11,9 +12,13 @@
 #include "../types/Point.h"
 #include "../utility/NearlyEqual.h"
 #include "../utility/OperatorDegree.h"
+#include "../utility/Random.h"
 
 #include <algorithm>
-#include <random>
+#include <array>
+#include <cmath>
+#include <initializer_list>
+#include <limits>
 
 #include <cassert>
 
@@ -25,36 +30,50 @@ using Angle = types::Angle;
 using Point = types::Point;
 using Quadrant = types::Quadrant;
 
+constexpr double contactPenetration{1e-6};
+
 namespace impl {
 
 template <typename GameObjectType>
-std::vector<ObjectIntersectionPair>
-getObjectIntersectionPairs(const Ball& ball,
-                           const std::vector<GameObjectType>& gameObjects)
+void updateTimeOfImpact(const Ball& ball, const Point& way,
+                        const std::vector<GameObjectType>& gameObjects,
+                        std::optional<double>& firstTimeOfImpact)
 {
-    std::vector<ObjectIntersectionPair> objectIntersectionPairs;
-
     for (const auto& gameObject : gameObjects) {
-        auto intersection = getIntersection(ball, gameObject);
+        updateTimeOfImpact(ball, way, gameObject, firstTimeOfImpact);
+    }
+}
+
+template void updateTimeOfImpact<Wall>(
+    const Ball& ball, const Point& way, const std::vector<Wall>& gameObjects,
+    std::optional<double>& firstTimeOfImpact);
+
+template void updateTimeOfImpact<IndestructibleBrick>(
+    const Ball& ball, const Point& way,
+    const std::vector<IndestructibleBrick>& gameObjects,
+    std::optional<double>& firstTimeOfImpact);
+
+template <typename GameObjectType>
+void addHits(const Ball& ball, const std::vector<GameObjectType>& gameObjects,
+             ObjectKind kind, std::vector<Hit>& hits)
+{
+    for (std::size_t i = 0; i < gameObjects.size(); ++i) {
+        auto intersection = getIntersection(ball, gameObjects[i]);
 
         if (intersection == Intersection::none) {
             continue;
         }
-        auto uniqueGameObject = std::make_unique<GameObjectType>(gameObject);
-
-        objectIntersectionPairs.push_back(
-            ObjectIntersectionPair{std::move(uniqueGameObject), intersection});
+        hits.push_back(Hit{&gameObjects[i], kind, i, intersection});
     }
-    return objectIntersectionPairs;
 }
 
-template std::vector<ObjectIntersectionPair>
-getObjectIntersectionPairs<IndestructibleBrick>(
-    const Ball& ball, const std::vector<IndestructibleBrick>& gameObjects);
+template void addHits<IndestructibleBrick>(
+    const Ball& ball, const std::vector<IndestructibleBrick>& gameObjects,
+    ObjectKind kind, std::vector<Hit>& hits);
 
-template std::vector<ObjectIntersectionPair>
-getObjectIntersectionPairs<Wall>(const Ball& ball,
-                                 const std::vector<Wall>& gameObjects);
+template void addHits<Wall>(const Ball& ball,
+                            const std::vector<Wall>& gameObjects,
+                            ObjectKind kind, std::vector<Hit>& hits);
 
 } // namespace impl
 
@@ -70,60 +89,100 @@ bool reflectFromPlatform(Ball& ball, const Platform& platform)
     return true;
 }
 
-std::vector<std::shared_ptr<GameObject>> reflectFromGameObjects(
-    Ball& ball, const std::vector<Wall>& walls,
+bool reflectFromPlatform(Ball& ball, const Platform& platform,
+                         utility::Random& random, const Angle& maxDeviation)
+{
+    if (!reflectFromPlatform(ball, platform)) {
+        return false;
+    }
+    ball.setAngle(impl::deviate(ball.angle(), random, maxDeviation));
+    return true;
+}
+
+double moveToFirstContact(
+    Ball& ball, double elapsedTimeMS, const std::vector<Wall>& walls,
     const std::vector<IndestructibleBrick>& indestructibleBricks,
-    std::vector<Brick>& bricks)
+    const std::vector<Brick>& bricks, BrickGrid& brickGrid,
+    const Platform& platform)
 {
-    auto wallPairs = impl::getObjectIntersectionPairs(ball, walls);
+    auto movedBall = ball;
+    movedBall.move(elapsedTimeMS);
+    return moveToFirstContact(ball, elapsedTimeMS, movedBall.topLeft(), walls,
+                              indestructibleBricks, bricks, brickGrid,
+                              platform);
+}
 
-    auto indBrickPairs =
-        impl::getObjectIntersectionPairs(ball, indestructibleBricks);
+double moveToFirstContact(
+    Ball& ball, double elapsedTimeMS, const Point& end,
+    const std::vector<Wall>& walls,
+    const std::vector<IndestructibleBrick>& indestructibleBricks,
+    const std::vector<Brick>& bricks, BrickGrid& brickGrid,
+    const Platform& platform)
+{
+    auto start = ball.topLeft();
+    Point way{end.x - start.x, end.y - start.y};
+
+    std::optional<double> firstTimeOfImpact;
+    impl::updateTimeOfImpact(ball, way, walls, firstTimeOfImpact);
+    impl::updateTimeOfImpact(ball, way, indestructibleBricks,
+                             firstTimeOfImpact);
+
+    Point areaTopLeft{std::min(start.x, end.x), std::min(start.y, end.y)};
+    Point areaBottomRight{std::max(start.x, end.x) + ball.width(),
+                          std::max(start.y, end.y) + ball.height()};
+    for (auto index : brickGrid.query(areaTopLeft, areaBottomRight)) {
+        impl::updateTimeOfImpact(ball, way, bricks[index], firstTimeOfImpact);
+    }
+    impl::updateTimeOfImpact(ball, way, platform, firstTimeOfImpact);
 
-    auto brickPairs = impl::getObjectIntersectionPairs(ball, bricks);
+    if (!firstTimeOfImpact) {
+        ball.setTopLeft(end);
+        return 0.0;
+    }
 
-    std::vector<impl::ObjectIntersectionPair> objectIntersectionPairs;
-    objectIntersectionPairs.reserve(wallPairs.size() + indBrickPairs.size() +
-                                    brickPairs.size());
+    auto wayLength = std::max(std::abs(way.x), std::abs(way.y));
+    auto fraction =
+        std::min(1.0, *firstTimeOfImpact + contactPenetration / wayLength);
+    ball.setTopLeft(Point{start.x + way.x * fraction,
+                          start.y + way.y * fraction});
+    return elapsedTimeMS * (1.0 - fraction);
+}
 
-    std::move(wallPairs.begin(), wallPairs.end(),
-              std::back_inserter(objectIntersectionPairs));
-    std::move(indBrickPairs.begin(), indBrickPairs.end(),
-              std::back_inserter(objectIntersectionPairs));
-    std::move(brickPairs.begin(), brickPairs.end(),
-              std::back_inserter(objectIntersectionPairs));
+void reflectFromGameObjects(
+    Ball& ball, const std::vector<Wall>& walls,
+    const std::vector<IndestructibleBrick>& indestructibleBricks,
+    std::vector<Brick>& bricks, std::vector<Hit>& hits)
+{
+    hits.clear();
+    impl::addHits(ball, walls, ObjectKind::wall, hits);
+    impl::addHits(ball, indestructibleBricks, ObjectKind::indestructibleBrick,
+                  hits);
+    impl::addHits(ball, bricks, hits);
 
-    if (objectIntersectionPairs.size() == 1) {
-        impl::reflectFromSingleObject(ball,
-                                      *objectIntersectionPairs[0].object.get(),
-                                      objectIntersectionPairs[0].intersection);
-        auto angle = impl::clampAngle(ball.angle());
-        ball.setAngle(angle);
-        return std::vector<std::shared_ptr<GameObject>>{
-            std::move(objectIntersectionPairs[0].object)};
-    }
-    if (objectIntersectionPairs.size() > 1) {
-        reflectFromMultipleObjects(ball, objectIntersectionPairs);
-        auto angle = impl::clampAngle(ball.angle());
-        ball.setAngle(angle);
+    impl::reflectFromHits(ball, hits);
+}
 
-        std::vector<std::shared_ptr<GameObject>> hitObjects;
-        for (auto& objectIntersectionPair : objectIntersectionPairs) {
-            hitObjects.push_back(std::move(objectIntersectionPair.object));
-        }
-        return hitObjects;
-    }
-    return std::vector<std::shared_ptr<GameObject>>{};
+void reflectFromGameObjects(
+    Ball& ball, const std::vector<Wall>& walls,
+    const std::vector<IndestructibleBrick>& indestructibleBricks,
+    std::vector<Brick>& bricks, BrickGrid& brickGrid, std::vector<Hit>& hits)
+{
+    hits.clear();
+    impl::addHits(ball, walls, ObjectKind::wall, hits);
+    impl::addHits(ball, indestructibleBricks, ObjectKind::indestructibleBrick,
+                  hits);
+    impl::addHits(ball, bricks, brickGrid, hits);
+
+    impl::reflectFromHits(ball, hits);
 }
 
 namespace impl {
 
-std::vector<ObjectIntersectionPair>
-getObjectIntersectionPairs(const Ball& ball, std::vector<Brick>& bricks)
+void addHits(const Ball& ball, std::vector<Brick>& bricks,
+             std::vector<Hit>& hits)
 {
-    std::vector<ObjectIntersectionPair> objectIntersectionPairs;
-
-    for (auto& brick : bricks) {
+    for (std::size_t i = 0; i < bricks.size(); ++i) {
+        auto& brick = bricks[i];
         if (brick.isDestroyed()) {
             continue;
         }
@@ -134,56 +193,147 @@ getObjectIntersectionPairs(const Ball& ball, std::vector<Brick>& bricks)
             continue;
         }
         brick.decreaseHitpoints();
-        auto uniqueGameObject = std::make_unique<Brick>(brick);
-
-        objectIntersectionPairs.push_back(
-            ObjectIntersectionPair{std::move(uniqueGameObject), intersection});
+        hits.push_back(Hit{&brick, ObjectKind::brick, i, intersection});
     }
-    return objectIntersectionPairs;
 }
 
-Intersection getIntersection(const Ball& ball, const GameObject& obj)
+void addHits(const Ball& ball, std::vector<Brick>& bricks,
+             BrickGrid& brickGrid, std::vector<Hit>& hits)
 {
-    std::vector<Intersection> intersections{};
+    for (auto index : brickGrid.query(ball.topLeft(), ball.bottomRight())) {
+        auto& brick = bricks[index];
+        if (brick.isDestroyed()) {
+            continue;
+        }
+
+        auto intersection = getIntersection(ball, brick);
 
-    if (topLeftIntersectsWithBottomRight(ball.topLeft(), obj.bottomRight(),
-                                         obj.topLeft())) {
-        intersections.push_back(Intersection::bottomRight);
+        if (intersection == Intersection::none) {
+            continue;
+        }
+        brick.decreaseHitpoints();
+        brickGrid.update(index, brick);
+        hits.push_back(Hit{&brick, ObjectKind::brick, index, intersection});
     }
-    if (topRightIntersectsWithBottomLeft(ball.topRight(), obj.bottomLeft(),
-                                         obj.topRight())) {
-        intersections.push_back(Intersection::bottomLeft);
+}
+
+void reflectFromHits(Ball& ball, const std::vector<Hit>& hits)
+{
+    if (hits.empty()) {
+        return;
     }
-    if (bottomLeftIntersectsWithTopRight(ball.bottomLeft(), obj.topRight(),
-                                         obj.bottomLeft())) {
-        intersections.push_back(Intersection::topRight);
+    if (hits.size() == 1) {
+        reflectFromSingleObject(ball, *hits[0].object, hits[0].intersection);
     }
-    if (bottomRightIntersectsWithTopLeft(ball.bottomRight(), obj.topLeft(),
-                                         obj.bottomRight())) {
-        intersections.push_back(Intersection::topLeft);
+    else {
+        reflectFromMultipleObjects(ball, hits);
     }
+    auto angle = clampAngle(ball.angle());
+    ball.setAngle(angle);
+}
 
-    if (intersections.empty()) {
-        return Intersection::none;
+std::optional<double> timeOfImpact(const Ball& ball, const Point& way,
+                                   const GameObject& obj)
+{
+    auto entry = -std::numeric_limits<double>::infinity();
+    auto exit = std::numeric_limits<double>::infinity();
+
+    auto sweepAxis = [&entry, &exit](double ballMin, double ballMax,
+                                     double objMin, double objMax,
+                                     double distance) {
+        if (distance == 0.0) {
+            return ballMax > objMin && objMax > ballMin;
+        }
+        auto timeA = (objMin - ballMax) / distance;
+        auto timeB = (objMax - ballMin) / distance;
+        entry = std::max(entry, std::min(timeA, timeB));
+        exit = std::min(exit, std::max(timeA, timeB));
+        return true;
+    };
+
+    auto ballTopLeft = ball.topLeft();
+    auto ballBottomRight = ball.bottomRight();
+    auto objTopLeft = obj.topLeft();
+    auto objBottomRight = obj.bottomRight();
+
+    if (!sweepAxis(ballTopLeft.x, ballBottomRight.x, objTopLeft.x,
+                   objBottomRight.x, way.x) ||
+        !sweepAxis(ballTopLeft.y, ballBottomRight.y, objTopLeft.y,
+                   objBottomRight.y, way.y)) {
+        return std::nullopt;
     }
-    if (intersections.size() == 1) {
-        return intersections[0];
+    if (entry >= exit || entry < 0.0 || entry > 1.0) {
+        return std::nullopt;
     }
-    if (intersections.size() == 2) {
-        if (intersectsLeft(intersections)) {
-            return Intersection::left;
-        }
-        if (intersectsTop(intersections)) {
-            return Intersection::top;
-        }
-        if (intersectsRight(intersections)) {
-            return Intersection::right;
-        }
-        if (intersectsBottom(intersections)) {
-            return Intersection::bottom;
-        }
+    return entry;
+}
+
+void updateTimeOfImpact(const Ball& ball, const Point& way,
+                        const GameObject& obj,
+                        std::optional<double>& firstTimeOfImpact)
+{
+    auto time = timeOfImpact(ball, way, obj);
+    if (time && (!firstTimeOfImpact || *time < *firstTimeOfImpact)) {
+        firstTimeOfImpact = time;
+    }
+}
+
+Intersection getIntersection(const Ball& ball, const GameObject& obj)
+{
+    return cornersToIntersection(getIntersectedCorners(ball, obj));
+}
+
+Corners getIntersectedCorners(const Ball& ball, const GameObject& obj)
+{
+    auto ballTopLeft = ball.topLeft();
+    auto ballBottomRight = ball.bottomRight();
+    auto objTopLeft = obj.topLeft();
+    auto objBottomRight = obj.bottomRight();
+
+    Point ballTopRight{ballBottomRight.x, ballTopLeft.y};
+    Point ballBottomLeft{ballTopLeft.x, ballBottomRight.y};
+    Point objTopRight{objBottomRight.x, objTopLeft.y};
+    Point objBottomLeft{objTopLeft.x, objBottomRight.y};
+
+    Corners corners{0};
+    if (topLeftIntersectsWithBottomRight(ballTopLeft, objBottomRight,
+                                         objTopLeft)) {
+        corners |= cornerBottomRight;
+    }
+    if (topRightIntersectsWithBottomLeft(ballTopRight, objBottomLeft,
+                                         objTopRight)) {
+        corners |= cornerBottomLeft;
     }
-    return Intersection::none;
+    if (bottomLeftIntersectsWithTopRight(ballBottomLeft, objTopRight,
+                                         objBottomLeft)) {
+        corners |= cornerTopRight;
+    }
+    if (bottomRightIntersectsWithTopLeft(ballBottomRight, objTopLeft,
+                                         objBottomRight)) {
+        corners |= cornerTopLeft;
+    }
+    return corners;
+}
+
+constexpr std::array<Intersection, 16> makeIntersectionTable()
+{
+    std::array<Intersection, 16> table{};
+    table[cornerTopLeft] = Intersection::topLeft;
+    table[cornerTopRight] = Intersection::topRight;
+    table[cornerBottomRight] = Intersection::bottomRight;
+    table[cornerBottomLeft] = Intersection::bottomLeft;
+    table[cornerBottomLeft | cornerTopLeft] = Intersection::left;
+    table[cornerTopLeft | cornerTopRight] = Intersection::top;
+    table[cornerTopRight | cornerBottomRight] = Intersection::right;
+    table[cornerBottomRight | cornerBottomLeft] = Intersection::bottom;
+    return table;
+}
+
+Intersection cornersToIntersection(Corners corners)
+{
+    static constexpr auto table = makeIntersectionTable();
+    assert(corners < table.size());
+    return table[corners];
 }
 
 bool bottomRightIntersectsWithTopLeft(const Point& bottomRight1,
@@ -226,56 +376,6 @@ bool topRightIntersectsWithBottomLeft(const Point& topRight1,
     return xIsInside and yIsInside;
 }
 
-bool intersectsLeft(const std::vector<Intersection>& intersections)
-{
-    assert(intersections.size() == 2);
-    std::vector<Intersection> expectedIntersections{Intersection::bottomLeft,
-                                                    Intersection::topLeft};
-    return allExpectedIntersectionsAreInIntersections(expectedIntersections,
-                                                      intersections);
-}
-
-bool intersectsTop(const std::vector<Intersection>& intersections)
-{
-    assert(intersections.size() == 2);
-    std::vector<Intersection> expectedIntersections{Intersection::topLeft,
-                                                    Intersection::topRight};
-    return allExpectedIntersectionsAreInIntersections(expectedIntersections,
-                                                      intersections);
-}
-
-bool intersectsRight(const std::vector<Intersection>& intersections)
-{
-    assert(intersections.size() == 2);
-    std::vector<Intersection> expectedIntersections{Intersection::topRight,
-                                                    Intersection::bottomRight};
-    return allExpectedIntersectionsAreInIntersections(expectedIntersections,
-                                                      intersections);
-}
-
-bool intersectsBottom(const std::vector<Intersection>& intersections)
-{
-    assert(intersections.size() == 2);
-    std::vector<Intersection> expectedIntersections{Intersection::bottomRight,
-                                                    Intersection::bottomLeft};
-    return allExpectedIntersectionsAreInIntersections(expectedIntersections,
-                                                      intersections);
-}
-
-bool allExpectedIntersectionsAreInIntersections(
-    const std::vector<Intersection>& expectedIntersections,
-    const std::vector<Intersection>& intersections)
-{
-    for (const auto& expectedIntersection : expectedIntersections) {
-        auto it = std::find(intersections.begin(), intersections.end(),
-                            expectedIntersection);
-        if (it == intersections.end()) {
-            return false;
-        }
-    }
-    return true;
-}
-
 void reflectFromSinglePlatform(Ball& ball, const Platform& platform,
                                const Intersection& intersection)
 {
@@ -359,68 +459,60 @@ void reflectFromSingleObject(Ball& ball, const GameObject& obj,
     }
 }
 
-void reflectFromMultipleObjects(
-    Ball& ball,
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+void reflectFromMultipleObjects(Ball& ball, const std::vector<Hit>& hits)
 {
-    assert(objectIntersectionPairs.size() > 1);
+    assert(hits.size() > 1);
 
-    if (intersectsFromLeftWithMultiObjects(objectIntersectionPairs)) {
-        reflectFromCollisionWithLeft(ball,
-                                     *objectIntersectionPairs[0].object.get());
+    if (intersectsFromLeftWithMultiObjects(hits)) {
+        reflectFromCollisionWithLeft(ball, *hits[0].object);
     }
-    else if (intersectsFromTopWithMultiObjects(objectIntersectionPairs)) {
-        reflectFromCollisionWithTop(ball,
-                                    *objectIntersectionPairs[0].object.get());
+    else if (intersectsFromTopWithMultiObjects(hits)) {
+        reflectFromCollisionWithTop(ball, *hits[0].object);
     }
-    else if (intersectsFromRightWithMultiObjects(objectIntersectionPairs)) {
-        reflectFromCollisionWithRight(ball,
-                                      *objectIntersectionPairs[0].object.get());
+    else if (intersectsFromRightWithMultiObjects(hits)) {
+        reflectFromCollisionWithRight(ball, *hits[0].object);
     }
-    else if (intersectsFromBottomWithMultiObjects(objectIntersectionPairs)) {
-        reflectFromCollisionWithBottom(
-            ball, *objectIntersectionPairs[0].object.get());
+    else if (intersectsFromBottomWithMultiObjects(hits)) {
+        reflectFromCollisionWithBottom(ball, *hits[0].object);
     }
 
-    if (objectIntersectionPairs.size() == 2) {
-        if (reflectFromTwoObjectsInCorner(ball, objectIntersectionPairs)) {
+    if (hits.size() == 2) {
+        if (reflectFromTwoObjectsInCorner(ball, hits)) {
             return;
         }
     }
-    if (objectIntersectionPairs.size() == 3) {
-        if (reflectFromThreeObjectsInCorner(ball, objectIntersectionPairs)) {
+    if (hits.size() == 3) {
+        if (reflectFromThreeObjectsInCorner(ball, hits)) {
             return;
         }
     }
 }
 
-bool reflectFromTwoObjectsInCorner(
-    Ball& ball,
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+bool reflectFromTwoObjectsInCorner(Ball& ball, const std::vector<Hit>& hits)
 {
-    if (intersectsInTopLeftCornerWithTwoObjects(objectIntersectionPairs)) {
-        putBeforeIntersectsWithTopLeftCorner(ball, objectIntersectionPairs);
+    if (intersectsInTopLeftCornerWithTwoObjects(hits)) {
+        putBeforeIntersectsWithTopLeftCorner(ball, hits);
         auto angle = ball.angle();
         angle.set(angle.get() - 180.0_deg);
         ball.setAngle(angle);
         return true;
     }
-    if (intersectsInTopRightCornerWithTwoObjects(objectIntersectionPairs)) {
-        putBeforeIntersectsWithTopRightCorner(ball, objectIntersectionPairs);
+    if (intersectsInTopRightCornerWithTwoObjects(hits)) {
+        putBeforeIntersectsWithTopRightCorner(ball, hits);
         auto angle = ball.angle();
         angle.set(angle.get() - 180.0_deg);
         ball.setAngle(angle);
         return true;
     }
-    if (intersectsInBottomRightCornerWithTwoObjects(objectIntersectionPairs)) {
-        putBeforeIntersectsWithBottomRightCorner(ball, objectIntersectionPairs);
+    if (intersectsInBottomRightCornerWithTwoObjects(hits)) {
+        putBeforeIntersectsWithBottomRightCorner(ball, hits);
         auto angle = ball.angle();
         angle.set(angle.get() + 180.0_deg);
         ball.setAngle(angle);
         return true;
     }
-    if (intersectsInBottomLeftCornerWithTwoObjects(objectIntersectionPairs)) {
-        putBeforeIntersectsWithBottomLeftCorner(ball, objectIntersectionPairs);
+    if (intersectsInBottomLeftCornerWithTwoObjects(hits)) {
+        putBeforeIntersectsWithBottomLeftCorner(ball, hits);
         auto angle = ball.angle();
         angle.set(angle.get() + 180.0_deg);
         ball.setAngle(angle);
@@ -429,34 +521,31 @@ bool reflectFromTwoObjectsInCorner(
     return false;
 }
 
-bool reflectFromThreeObjectsInCorner(
-    Ball& ball,
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+bool reflectFromThreeObjectsInCorner(Ball& ball, const std::vector<Hit>& hits)
 {
-    if (intersectsInTopLeftCornerWithThreeObjects(objectIntersectionPairs)) {
-        putBeforeIntersectsWithTopLeftCorner(ball, objectIntersectionPairs);
+    if (intersectsInTopLeftCornerWithThreeObjects(hits)) {
+        putBeforeIntersectsWithTopLeftCorner(ball, hits);
         auto angle = ball.angle();
         angle.set(angle.get() - 180.0_deg);
         ball.setAngle(angle);
         return true;
     }
-    if (intersectsInTopRightCornerWithThreeObjects(objectIntersectionPairs)) {
-        putBeforeIntersectsWithTopRightCorner(ball, objectIntersectionPairs);
+    if (intersectsInTopRightCornerWithThreeObjects(hits)) {
+        putBeforeIntersectsWithTopRightCorner(ball, hits);
         auto angle = ball.angle();
         angle.set(angle.get() - 180.0_deg);
         ball.setAngle(angle);
         return true;
     }
-    if (intersectsInBottomRightCornerWithThreeObjects(
-            objectIntersectionPairs)) {
-        putBeforeIntersectsWithBottomRightCorner(ball, objectIntersectionPairs);
+    if (intersectsInBottomRightCornerWithThreeObjects(hits)) {
+        putBeforeIntersectsWithBottomRightCorner(ball, hits);
         auto angle = ball.angle();
         angle.set(angle.get() + 180.0_deg);
         ball.setAngle(angle);
         return true;
     }
-    if (intersectsInBottomLeftCornerWithThreeObjects(objectIntersectionPairs)) {
-        putBeforeIntersectsWithBottomLeftCorner(ball, objectIntersectionPairs);
+    if (intersectsInBottomLeftCornerWithThreeObjects(hits)) {
+        putBeforeIntersectsWithBottomLeftCorner(ball, hits);
         auto angle = ball.angle();
         angle.set(angle.get() + 180.0_deg);
         ball.setAngle(angle);
@@ -465,54 +554,46 @@ bool reflectFromThreeObjectsInCorner(
     return false;
 }
 
-bool intersectsInTopLeftCornerWithTwoObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+bool intersectsInTopLeftCornerWithTwoObjects(const std::vector<Hit>& hits)
 {
-    std::vector<Intersection> intersectionsVariant1{Intersection::right,
-                                                    Intersection::bottomLeft};
-    auto isVariant1 = allIntersectionsAreInObjectIntersectionPairs(
-        intersectionsVariant1, objectIntersectionPairs);
+    std::initializer_list<Intersection> intersectionsVariant1{
+        Intersection::right, Intersection::bottomLeft};
+    auto isVariant1 = allIntersectionsAreInHits(intersectionsVariant1, hits);
     if (isVariant1) {
         return true;
     }
-    std::vector<Intersection> intersectionsVariant2{Intersection::topRight,
-                                                    Intersection::bottom};
-    auto isVariant2 = allIntersectionsAreInObjectIntersectionPairs(
-        intersectionsVariant2, objectIntersectionPairs);
+    std::initializer_list<Intersection> intersectionsVariant2{
+        Intersection::topRight, Intersection::bottom};
+    auto isVariant2 = allIntersectionsAreInHits(intersectionsVariant2, hits);
     return isVariant2;
 }
 
-bool intersectsInTopLeftCornerWithThreeObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+bool intersectsInTopLeftCornerWithThreeObjects(const std::vector<Hit>& hits)
 {
-    assert(objectIntersectionPairs.size() == 3);
+    assert(hits.size() == 3);
 
-    std::vector<Intersection> intersections{Intersection::bottomLeft,
-                                            Intersection::bottomRight,
-                                            Intersection::topRight};
+    std::initializer_list<Intersection> intersections{Intersection::bottomLeft,
+                                                      Intersection::bottomRight,
+                                                      Intersection::topRight};
 
-    return allIntersectionsAreInObjectIntersectionPairs(
-        intersections, objectIntersectionPairs);
+    return allIntersectionsAreInHits(intersections, hits);
 }
 
-void putBeforeIntersectsWithTopLeftCorner(
-    Ball& ball,
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+void putBeforeIntersectsWithTopLeftCorner(Ball& ball,
+                                          const std::vector<Hit>& hits)
 {
-    for (const auto& objectIntersectionPair : objectIntersectionPairs) {
-        auto intersection = objectIntersectionPair.intersection;
+    for (const auto& hit : hits) {
+        auto intersection = hit.intersection;
         if (intersection == Intersection::bottomLeft ||
             intersection == Intersection::bottom) {
-            putBeforeIntersectsWithTopY(ball,
-                                        *objectIntersectionPair.object.get());
+            putBeforeIntersectsWithTopY(ball, *hit.object);
         }
         else if (intersection == Intersection::bottomRight) {
             ;
         }
         else if (intersection == Intersection::topRight ||
                  intersection == Intersection::right) {
-            putBeforeIntersectsWithLeftX(ball,
-                                         *objectIntersectionPair.object.get());
+            putBeforeIntersectsWithLeftX(ball, *hit.object);
         }
         else {
             assert(true == false);
@@ -520,54 +601,46 @@ void putBeforeIntersectsWithTopLeftCorner(
     }
 }
 
-bool intersectsInTopRightCornerWithTwoObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+bool intersectsInTopRightCornerWithTwoObjects(const std::vector<Hit>& hits)
 {
-    std::vector<Intersection> intersectionsVariant1{Intersection::bottomRight,
-                                                    Intersection::left};
-    auto isVariant1 = allIntersectionsAreInObjectIntersectionPairs(
-        intersectionsVariant1, objectIntersectionPairs);
+    std::initializer_list<Intersection> intersectionsVariant1{
+        Intersection::bottomRight, Intersection::left};
+    auto isVariant1 = allIntersectionsAreInHits(intersectionsVariant1, hits);
     if (isVariant1) {
         return true;
     }
-    std::vector<Intersection> intersectionsVariant2{Intersection::bottom,
-                                                    Intersection::topLeft};
-    auto isVariant2 = allIntersectionsAreInObjectIntersectionPairs(
-        intersectionsVariant2, objectIntersectionPairs);
+    std::initializer_list<Intersection> intersectionsVariant2{
+        Intersection::bottom, Intersection::topLeft};
+    auto isVariant2 = allIntersectionsAreInHits(intersectionsVariant2, hits);
     return isVariant2;
 }
 
-bool intersectsInTopRightCornerWithThreeObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+bool intersectsInTopRightCornerWithThreeObjects(const std::vector<Hit>& hits)
 {
-    assert(objectIntersectionPairs.size() == 3);
+    assert(hits.size() == 3);
 
-    std::vector<Intersection> intersections{Intersection::bottomRight,
-                                            Intersection::bottomLeft,
-                                            Intersection::topLeft};
+    std::initializer_list<Intersection> intersections{Intersection::bottomRight,
+                                                      Intersection::bottomLeft,
+                                                      Intersection::topLeft};
 
-    return allIntersectionsAreInObjectIntersectionPairs(
-        intersections, objectIntersectionPairs);
+    return allIntersectionsAreInHits(intersections, hits);
 }
 
-void putBeforeIntersectsWithTopRightCorner(
-    Ball& ball,
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+void putBeforeIntersectsWithTopRightCorner(Ball& ball,
+                                           const std::vector<Hit>& hits)
 {
-    for (const auto& objectIntersectionPair : objectIntersectionPairs) {
-        auto intersection = objectIntersectionPair.intersection;
+    for (const auto& hit : hits) {
+        auto intersection = hit.intersection;
         if (intersection == Intersection::bottomRight ||
             intersection == Intersection::bottom) {
-            putBeforeIntersectsWithTopY(ball,
-                                        *objectIntersectionPair.object.get());
+            putBeforeIntersectsWithTopY(ball, *hit.object);
         }
         else if (intersection == Intersection::bottomLeft) {
             ;
         }
         else if (intersection == Intersection::topLeft ||
                  intersection == Intersection::left) {
-            putBeforeIntersectsWithRightX(ball,
-                                          *objectIntersectionPair.object.get());
+            putBeforeIntersectsWithRightX(ball, *hit.object);
         }
         else {
             assert(true == false);
@@ -575,54 +648,46 @@ void putBeforeIntersectsWithTopRightCorner(
     }
 }
 
-bool intersectsInBottomRightCornerWithTwoObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+bool intersectsInBottomRightCornerWithTwoObjects(const std::vector<Hit>& hits)
 {
-    std::vector<Intersection> intersectionsVariant1{Intersection::top,
-                                                    Intersection::bottomLeft};
-    auto isVariant1 = allIntersectionsAreInObjectIntersectionPairs(
-        intersectionsVariant1, objectIntersectionPairs);
+    std::initializer_list<Intersection> intersectionsVariant1{
+        Intersection::top, Intersection::bottomLeft};
+    auto isVariant1 = allIntersectionsAreInHits(intersectionsVariant1, hits);
     if (isVariant1) {
         return true;
     }
-    std::vector<Intersection> intersectionsVariant2{Intersection::left,
-                                                    Intersection::topRight};
-    auto isVariant2 = allIntersectionsAreInObjectIntersectionPairs(
-        intersectionsVariant2, objectIntersectionPairs);
+    std::initializer_list<Intersection> intersectionsVariant2{
+        Intersection::left, Intersection::topRight};
+    auto isVariant2 = allIntersectionsAreInHits(intersectionsVariant2, hits);
     return isVariant2;
 }
 
-bool intersectsInBottomRightCornerWithThreeObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+bool intersectsInBottomRightCornerWithThreeObjects(const std::vector<Hit>& hits)
 {
-    assert(objectIntersectionPairs.size() == 3);
+    assert(hits.size() == 3);
 
-    std::vector<Intersection> intersections{Intersection::topRight,
-                                            Intersection::topLeft,
-                                            Intersection::bottomLeft};
+    std::initializer_list<Intersection> intersections{Intersection::topRight,
+                                                      Intersection::topLeft,
+                                                      Intersection::bottomLeft};
 
-    return allIntersectionsAreInObjectIntersectionPairs(
-        intersections, objectIntersectionPairs);
+    return allIntersectionsAreInHits(intersections, hits);
 }
 
-void putBeforeIntersectsWithBottomRightCorner(
-    Ball& ball,
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+void putBeforeIntersectsWithBottomRightCorner(Ball& ball,
+                                              const std::vector<Hit>& hits)
 {
-    for (const auto& objectIntersectionPair : objectIntersectionPairs) {
-        auto intersection = objectIntersectionPair.intersection;
+    for (const auto& hit : hits) {
+        auto intersection = hit.intersection;
         if (intersection == Intersection::topRight ||
             intersection == Intersection::top) {
-            putBeforeIntersectsWithBottomY(
-                ball, *objectIntersectionPair.object.get());
+            putBeforeIntersectsWithBottomY(ball, *hit.object);
         }
         else if (intersection == Intersection::topLeft) {
             ;
         }
         else if (intersection == Intersection::bottomLeft ||
                  intersection == Intersection::left) {
-            putBeforeIntersectsWithRightX(ball,
-                                          *objectIntersectionPair.object.get());
+            putBeforeIntersectsWithRightX(ball, *hit.object);
         }
         else {
             assert(true == false);
@@ -630,54 +695,46 @@ void putBeforeIntersectsWithBottomRightCorner(
     }
 }
 
-bool intersectsInBottomLeftCornerWithTwoObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+bool intersectsInBottomLeftCornerWithTwoObjects(const std::vector<Hit>& hits)
 {
-    std::vector<Intersection> intersectionsVariant1{Intersection::top,
-                                                    Intersection::bottomRight};
-    auto isVariant1 = allIntersectionsAreInObjectIntersectionPairs(
-        intersectionsVariant1, objectIntersectionPairs);
+    std::initializer_list<Intersection> intersectionsVariant1{
+        Intersection::top, Intersection::bottomRight};
+    auto isVariant1 = allIntersectionsAreInHits(intersectionsVariant1, hits);
     if (isVariant1) {
         return true;
     }
-    std::vector<Intersection> intersectionsVariant2{Intersection::topLeft,
-                                                    Intersection::right};
-    auto isVariant2 = allIntersectionsAreInObjectIntersectionPairs(
-        intersectionsVariant2, objectIntersectionPairs);
+    std::initializer_list<Intersection> intersectionsVariant2{
+        Intersection::topLeft, Intersection::right};
+    auto isVariant2 = allIntersectionsAreInHits(intersectionsVariant2, hits);
     return isVariant2;
 }
 
-bool intersectsInBottomLeftCornerWithThreeObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+bool intersectsInBottomLeftCornerWithThreeObjects(const std::vector<Hit>& hits)
 {
-    assert(objectIntersectionPairs.size() == 3);
+    assert(hits.size() == 3);
 
-    std::vector<Intersection> intersections{Intersection::topLeft,
-                                            Intersection::topRight,
-                                            Intersection::bottomRight};
+    std::initializer_list<Intersection> intersections{
+        Intersection::topLeft, Intersection::topRight,
+        Intersection::bottomRight};
 
-    return allIntersectionsAreInObjectIntersectionPairs(
-        intersections, objectIntersectionPairs);
+    return allIntersectionsAreInHits(intersections, hits);
 }
 
-void putBeforeIntersectsWithBottomLeftCorner(
-    Ball& ball,
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+void putBeforeIntersectsWithBottomLeftCorner(Ball& ball,
+                                             const std::vector<Hit>& hits)
 {
-    for (const auto& objectIntersectionPair : objectIntersectionPairs) {
-        auto intersection = objectIntersectionPair.intersection;
+    for (const auto& hit : hits) {
+        auto intersection = hit.intersection;
         if (intersection == Intersection::topLeft ||
             intersection == Intersection::top) {
-            putBeforeIntersectsWithBottomY(
-                ball, *objectIntersectionPair.object.get());
+            putBeforeIntersectsWithBottomY(ball, *hit.object);
         }
         else if (intersection == Intersection::topRight) {
             ;
         }
         else if (intersection == Intersection::bottomRight ||
                  intersection == Intersection::right) {
-            putBeforeIntersectsWithLeftX(ball,
-                                         *objectIntersectionPair.object.get());
+            putBeforeIntersectsWithLeftX(ball, *hit.object);
         }
         else {
             assert(true == false);
@@ -685,62 +742,56 @@ void putBeforeIntersectsWithBottomLeftCorner(
     }
 }
 
-bool intersectsFromLeftWithMultiObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+bool intersectsFromLeftWithMultiObjects(const std::vector<Hit>& hits)
 {
-    assert(objectIntersectionPairs.size() > 1);
+    assert(hits.size() > 1);
 
-    std::vector<Intersection> intersections{
-        Intersection::left, Intersection::topLeft, Intersection::bottomLeft};
+    std::initializer_list<Intersection> intersections{Intersection::left,
+                                                      Intersection::topLeft,
+                                                      Intersection::bottomLeft};
 
-    return objectIntersectionPairsContainOnlyValuesFromIntersectionList(
-        intersections, objectIntersectionPairs);
+    return hitsContainOnlyValuesFromIntersectionList(intersections, hits);
 }
 
-bool intersectsFromTopWithMultiObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+bool intersectsFromTopWithMultiObjects(const std::vector<Hit>& hits)
 {
-    assert(objectIntersectionPairs.size() > 1);
+    assert(hits.size() > 1);
 
-    std::vector<Intersection> intersections{
-        Intersection::top, Intersection::topLeft, Intersection::topRight};
+    std::initializer_list<Intersection> intersections{Intersection::top,
+                                                      Intersection::topLeft,
+                                                      Intersection::topRight};
 
-    return objectIntersectionPairsContainOnlyValuesFromIntersectionList(
-        intersections, objectIntersectionPairs);
+    return hitsContainOnlyValuesFromIntersectionList(intersections, hits);
 }
 
-bool intersectsFromRightWithMultiObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+bool intersectsFromRightWithMultiObjects(const std::vector<Hit>& hits)
 {
-    assert(objectIntersectionPairs.size() > 1);
+    assert(hits.size() > 1);
 
-    std::vector<Intersection> intersections{
+    std::initializer_list<Intersection> intersections{
         Intersection::right, Intersection::topRight, Intersection::bottomRight};
 
-    return objectIntersectionPairsContainOnlyValuesFromIntersectionList(
-        intersections, objectIntersectionPairs);
+    return hitsContainOnlyValuesFromIntersectionList(intersections, hits);
 }
 
-bool intersectsFromBottomWithMultiObjects(
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+bool intersectsFromBottomWithMultiObjects(const std::vector<Hit>& hits)
 {
-    assert(objectIntersectionPairs.size() > 1);
+    assert(hits.size() > 1);
 
-    std::vector<Intersection> intersections{Intersection::bottom,
-                                            Intersection::bottomRight,
-                                            Intersection::bottomLeft};
+    std::initializer_list<Intersection> intersections{Intersection::bottom,
+                                                      Intersection::bottomRight,
+                                                      Intersection::bottomLeft};
 
-    return objectIntersectionPairsContainOnlyValuesFromIntersectionList(
-        intersections, objectIntersectionPairs);
+    return hitsContainOnlyValuesFromIntersectionList(intersections, hits);
 }
 
-bool objectIntersectionPairsContainOnlyValuesFromIntersectionList(
-    const std::vector<Intersection>& intersections,
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+bool hitsContainOnlyValuesFromIntersectionList(
+    std::initializer_list<Intersection> intersections,
+    const std::vector<Hit>& hits)
 {
-    for (const auto& objectIntersectionPair : objectIntersectionPairs) {
+    for (const auto& hit : hits) {
         auto it = std::find(intersections.begin(), intersections.end(),
-                            objectIntersectionPair.intersection);
+                            hit.intersection);
         if (it == intersections.end()) {
             return false;
         }
@@ -748,17 +799,16 @@ bool objectIntersectionPairsContainOnlyValuesFromIntersectionList(
     return true;
 }
 
-bool allIntersectionsAreInObjectIntersectionPairs(
-    const std::vector<Intersection>& intersections,
-    const std::vector<ObjectIntersectionPair>& objectIntersectionPairs)
+bool allIntersectionsAreInHits(
+    std::initializer_list<Intersection> intersections,
+    const std::vector<Hit>& hits)
 {
     for (const auto& intersection : intersections) {
-        auto it = std::find_if(
-            objectIntersectionPairs.begin(), objectIntersectionPairs.end(),
-            [intersection](const ObjectIntersectionPair& obj) {
-                return obj.intersection == intersection;
-            });
-        if (it == objectIntersectionPairs.end()) {
+        auto it = std::find_if(hits.begin(), hits.end(),
+                               [intersection](const Hit& hit) {
+                                   return hit.intersection == intersection;
+                               });
+        if (it == hits.end()) {
             return false;
         }
     }
@@ -975,6 +1025,15 @@ types::Angle clampAngle(const types::Angle& angle)
     return newAngle;
 }
 
+types::Angle deviate(const types::Angle& angle, utility::Random& random,
+                     const types::Angle& maxDeviation)
+{
+    auto max = static_cast<double>(maxDeviation.get());
+    auto deviated = angle;
+    deviated.set(angle.get() + random.uniform(-max, max));
+    return clampAngle(deviated);
+}
+
 bool isSmaller(double angle, double targetAngle, double delta)
 {
     return angle >= targetAngle - delta && angle < targetAngle;
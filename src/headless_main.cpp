@@ -0,0 +1,77 @@
+#include "Headless.h"
+#include "Simulation.h"
+
+#include "utility/TimeMeasure.h"
+
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+
+constexpr std::size_t captureWidth{780};
+constexpr std::size_t captureHeight{540};
+
+bool isPPMFilename(const std::string& filename)
+{
+    std::string extension{".ppm"};
+    return filename.size() >= extension.size() &&
+           filename.compare(filename.size() - extension.size(),
+                            extension.size(), extension) == 0;
+}
+
+int main(int argc, char* argv[])
+{
+    try {
+        int games = argc > 1 ? std::stoi(argv[1]) : 1;
+        long long maxTicks = argc > 2 ? std::stoll(argv[2]) : 1000000;
+
+        // Every tick is written as frame to the capture file, "-" for stdout.
+        // Files ending with .ppm get a PPM sequence, others raw RGBA frames.
+        std::string captureFilename = argc > 3 ? argv[3] : "";
+        std::ofstream captureFile;
+        bricks::TickCallback onTick;
+        if (!captureFilename.empty()) {
+            auto format = isPPMFilename(captureFilename)
+                              ? bricks::FrameFormat::ppm
+                              : bricks::FrameFormat::raw;
+            if (captureFilename != "-") {
+                captureFile.open(captureFilename, std::ios::binary);
+                if (!captureFile) {
+                    throw std::runtime_error("Capture file " +
+                                             captureFilename +
+                                             " could not be opened\n");
+                }
+            }
+            onTick = bricks::makeFrameCapture(
+                captureFilename == "-" ? std::cout : captureFile, format,
+                captureWidth, captureHeight);
+        }
+
+        auto levels = std::make_shared<bricks::LevelCache>(
+            bricks::getLevelFilenamesFromFolder("level"));
+
+        long long totalTicks{0};
+        auto start = bricks::utility::getCurrentTime();
+
+        for (int game = 0; game < games; ++game) {
+            bricks::Simulation simulation{levels};
+            auto result = bricks::runHeadless(simulation, bricks::followBall,
+                                              maxTicks, 16.0, onTick);
+            totalTicks += result.ticks;
+
+            std::clog << "game " << game << ": ticks " << result.ticks
+                      << " level " << result.level << " lifes "
+                      << result.lifes << " score " << result.score
+                      << (result.gameOver ? " (game over)" : "") << '\n';
+        }
+
+        auto elapsedMS = bricks::utility::getElapsedTime(
+            start, bricks::utility::getCurrentTime());
+        std::clog << games << " games, " << totalTicks << " ticks in "
+                  << elapsedMS << " ms\n";
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,37 @@
+#include "Level.h"
+
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+int main(int argc, char* argv[])
+{
+    try {
+        if (argc != 3) {
+            std::cerr << "usage: bricks_level_converter input.lvl "
+                         "output.blvl\n";
+            return 1;
+        }
+        std::string inputFilename{argv[1]};
+        std::string outputFilename{argv[2]};
+
+        auto level = bricks::readFromFile(inputFilename);
+
+        std::ofstream ofs{outputFilename, std::ios::binary};
+        if (!ofs) {
+            throw std::runtime_error("File:" + outputFilename +
+                                     " could not be opened\n");
+        }
+        bricks::writeBinary(ofs, level);
+
+        std::clog << inputFilename << ": " << level.bricks.size()
+                  << " bricks, " << level.indestructibleBricks.size()
+                  << " indestructible bricks written to " << outputFilename
+                  << '\n';
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+}
@@ -1,14 +1,35 @@
 #include "Game.h"
 
 #include <iostream>
+#include <string>
 
-int main()
+int main(int argc, char* argv[])
 {
     try {
         constexpr std::size_t screenWidth{780};
         constexpr std::size_t screenHeight{540};
+        constexpr double ticksPerSecond{60.0};
+        constexpr double maxFramesPerSecond{240.0};
 
-        bricks::Game game{screenWidth, screenHeight};
+        auto renderMode = bricks::RenderMode::full;
+        auto vsync = false;
+        std::string recordFilename;
+        for (int i = 1; i < argc; ++i) {
+            std::string argument{argv[i]};
+            if (argument == "--incremental") {
+                renderMode = bricks::RenderMode::incremental;
+            }
+            else if (argument == "--vsync") {
+                vsync = true;
+            }
+            else if (argument == "--record" && i + 1 < argc) {
+                recordFilename = argv[++i];
+            }
+        }
+
+        bricks::Game game{screenWidth, screenHeight, ticksPerSecond,
+                          maxFramesPerSecond, renderMode, vsync,
+                          recordFilename};
         game.run();
     }
     catch (const std::out_of_range& e) {
@@ -0,0 +1,52 @@
+#include "Replay.h"
+#include "Simulation.h"
+
+#include "utility/TimeMeasure.h"
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+int main(int argc, char* argv[])
+{
+    try {
+        if (argc < 2) {
+            std::cerr << "usage: bricks_replay replayFile [runs]\n";
+            return 1;
+        }
+        auto replay = bricks::loadReplay(argv[1]);
+        int runs = argc > 2 ? std::stoi(argv[2]) : 1;
+
+        auto levels = std::make_shared<bricks::LevelCache>(
+            bricks::getLevelFilenamesFromFolder("level"));
+
+        long long totalTicks{0};
+        auto start = bricks::utility::getCurrentTime();
+
+        for (int run = 0; run < runs; ++run) {
+            bricks::Simulation simulation{
+                levels, 0, replay.difficultyParameters, replay.seed,
+                replay.platformDeviation};
+            auto result = bricks::runReplay(simulation, replay);
+            totalTicks += result.ticks;
+
+            if (run == 0) {
+                std::clog << "ticks " << result.ticks << " level "
+                          << result.level << " lifes " << result.lifes
+                          << " score " << result.score
+                          << (result.gameOver ? " (game over)" : "") << '\n';
+            }
+        }
+
+        auto elapsedMS = bricks::utility::getElapsedTime(
+            start, bricks::utility::getCurrentTime());
+        auto playedMS = static_cast<double>(totalTicks) * replay.tickMS;
+        std::clog << runs << " runs, " << totalTicks << " ticks in "
+                  << elapsedMS << " ms, " << playedMS / elapsedMS
+                  << " times real time\n";
+    }
+    catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+}
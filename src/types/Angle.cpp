@@ -17,33 +17,33 @@ Angle::Angle()
 {
 }
 
-Angle::Angle(long double angle)
+Angle::Angle(Real angle)
     : mQuadrant{impl::calcQuadrant(angle)},
       mQuadrantAngle{impl::angleToQuadrantAngle(angle, mQuadrant)}
 {
 }
 
-long double Angle::Angle::get() const
+Real Angle::Angle::get() const
 {
     return impl::quadrantAngleToAngle(mQuadrantAngle, mQuadrant);
 }
 
-void Angle::set(long double angle)
+void Angle::set(Real angle)
 {
     angle = impl::calcAngleIfOutOfRange(angle);
     mQuadrant = impl::calcQuadrant(angle);
     mQuadrantAngle = impl::angleToQuadrantAngle(angle, mQuadrant);
 }
 
-long double Angle::quadrantAngle() const
+Real Angle::quadrantAngle() const
 {
     return mQuadrantAngle;
 }
 
-void Angle::setQuadrantAngle(long double quadrantAngle)
+void Angle::setQuadrantAngle(Real quadrantAngle)
 {
     if (quadrantAngle < 0.0_deg || quadrantAngle > 90.0_deg) {
-        std::cerr << "void Angle::setQuadrantAngle(long double quadrantAngle)\n"
+        std::cerr << "void Angle::setQuadrantAngle(Real quadrantAngle)\n"
                      "Out of Range 0.0_deg to 90.0_deg\n"
                      "supllied angle: "
                   << quadrantAngle << '\n';
@@ -102,12 +102,12 @@ void Angle::mirrorVertical()
 
 namespace impl {
 
-long double mirrorQuadrantAngle(long double quadrantAngle)
+Real mirrorQuadrantAngle(Real quadrantAngle)
 {
     return 90.0_deg - quadrantAngle;
 }
 
-Quadrant calcQuadrant(long double angle)
+Quadrant calcQuadrant(Real angle)
 {
     assert(angle >= 0.0 && angle <= 360.0);
 
@@ -123,37 +123,37 @@ Quadrant calcQuadrant(long double angle)
     return Quadrant::IV;
 }
 
-bool isInQuadrantI(long double angle)
+bool isInQuadrantI(Real angle)
 {
     return angle >= 0.0_deg && angle <= 90.0_deg;
 }
 
-bool isInQuadrantII(long double angle)
+bool isInQuadrantII(Real angle)
 {
     return angle > 90.0_deg && angle <= 180.0_deg;
 }
 
-bool isInQuadrantIII(long double angle)
+bool isInQuadrantIII(Real angle)
 {
     return angle > 180.0_deg && angle <= 270.0_deg;
 }
 
-bool isInQuadrantIV(long double angle)
+bool isInQuadrantIV(Real angle)
 {
     return angle > 270.0_deg && angle <= 360.0_deg;
 }
 
-long double angleToQuadrantAngle(long double angle, Quadrant quadrant)
+Real angleToQuadrantAngle(Real angle, Quadrant quadrant)
 {
     return angle - 90.0_deg * static_cast<int>(quadrant);
 }
 
-long double quadrantAngleToAngle(long double quadrantAngle, Quadrant quadrant)
+Real quadrantAngleToAngle(Real quadrantAngle, Quadrant quadrant)
 {
     return quadrantAngle + 90.0_deg * static_cast<int>(quadrant);
 }
 
-long double calcAngleIfOutOfRange(long double angle)
+Real calcAngleIfOutOfRange(Real angle)
 {
     while (angle < 0.0_deg) {
         angle += 360.0_deg;
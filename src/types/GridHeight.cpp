@@ -39,12 +39,12 @@ std::istream& operator>>(std::istream& is, GridHeight& obj)
     }
 
     is >> s;
-    if (!isNumber<int>(s)) {
+    auto h = parseNumber<int>(s);
+    if (!h) {
         is.setstate(std::ios_base::failbit);
         return is;
     }
-    auto h = std::stoi(s);
-    obj = std::move(GridHeight{h});
+    obj = std::move(GridHeight{*h});
 
     return is;
 }
@@ -39,12 +39,12 @@ std::istream& operator>>(std::istream& is, GridWidth& obj)
     }
 
     is >> s;
-    if (!isNumber<int>(s)) {
+    auto w = parseNumber<int>(s);
+    if (!w) {
         is.setstate(std::ios_base::failbit);
         return is;
     }
-    auto w = std::stoi(s);
-    obj = std::move(GridWidth{w});
+    obj = std::move(GridWidth{*w});
 
     return is;
 }
@@ -27,12 +27,12 @@ std::istream& operator>>(std::istream& is, Height& obj)
     }
 
     is >> s;
-    if (!isNumber<double>(s)) {
+    auto h = parseNumber<double>(s);
+    if (!h) {
         is.setstate(std::ios_base::failbit);
         return is;
     }
-    auto h = std::stod(s);
-    obj = std::move(Height{h});
+    obj = std::move(Height{*h});
 
     return is;
 }
@@ -38,12 +38,12 @@ std::istream& operator>>(std::istream& is, Hitpoints& obj)
     }
 
     is >> s;
-    if (!isNumber<int>(s)) {
+    auto hp = parseNumber<int>(s);
+    if (!hp) {
         is.setstate(std::ios_base::failbit);
         return is;
     }
-    auto hp = std::stoi(s);
-    obj = std::move(Hitpoints{hp});
+    obj = std::move(Hitpoints{*hp});
 
     return is;
 }
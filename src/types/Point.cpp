@@ -18,11 +18,11 @@ std::istream& operator>>(std::istream& is, Point& obj)
     }
 
     is >> s;
-    if (!isNumber<double>(s)) {
+    auto x = parseNumber<double>(s);
+    if (!x) {
         is.setstate(std::ios_base::failbit);
         return is;
     }
-    auto x = std::stod(s);
 
     is >> s;
     if (s != "Y") {
@@ -31,14 +31,14 @@ std::istream& operator>>(std::istream& is, Point& obj)
     }
 
     is >> s;
-    if (!isNumber<double>(s)) {
+    auto y = parseNumber<double>(s);
+    if (!y) {
         is.setstate(std::ios_base::failbit);
         return is;
     }
-    auto y = std::stod(s);
 
-    obj.x = x;
-    obj.y = y;
+    obj.x = *x;
+    obj.y = *y;
     return is;
 }
 } // namespace bricks::types
\ No newline at end of file
@@ -38,12 +38,12 @@ std::istream& operator>>(std::istream& is, Width& obj)
     }
 
     is >> s;
-    if (!isNumber<double>(s)) {
+    auto w = parseNumber<double>(s);
+    if (!w) {
         is.setstate(std::ios_base::failbit);
         return is;
     }
-    auto w = std::stod(s);
-    obj = std::move(Width{w});
+    obj = std::move(Width{*w});
 
     return is;
 }
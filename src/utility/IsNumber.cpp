@@ -1,24 +1,44 @@
 #include <IsNumber.h>
 
-#include <sstream>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
 
 namespace bricks::utility {
 
 template <typename T> bool isNumber(const std::string& s)
 {
-    if (s.empty()) {
-        return false;
-    }
-
-    std::istringstream ist(s);
-    T n;
-    ist >> std::noskipws >> n;
-
-    return ist.eof() && !ist.fail();
+    return parseNumber<T>(s).has_value();
 }
 
 template bool isNumber<int>(const std::string& s);
 template bool isNumber<std::size_t>(const std::string& s);
 template bool isNumber<long long>(const std::string& s);
 template bool isNumber<double>(const std::string& s);
-} // namespace bricks::utility
\ No newline at end of file
+
+template <typename T> std::optional<T> parseNumber(std::string_view s)
+{
+    if (s.size() > 1 && s.front() == '+' && s[1] != '-') {
+        s.remove_prefix(1);
+    }
+    T n{};
+    auto [end, error] = std::from_chars(s.data(), s.data() + s.size(), n);
+    if (s.empty() || error != std::errc{} || end != s.data() + s.size()) {
+        return std::nullopt;
+    }
+    // from_chars accepts nan, inf and infinity, the stream operators do not
+    if constexpr (std::is_floating_point_v<T>) {
+        if (!std::isfinite(n)) {
+            return std::nullopt;
+        }
+    }
+    return n;
+}
+
+template std::optional<int> parseNumber<int>(std::string_view s);
+template std::optional<std::size_t>
+parseNumber<std::size_t>(std::string_view s);
+template std::optional<long long> parseNumber<long long>(std::string_view s);
+template std::optional<double> parseNumber<double>(std::string_view s);
+} // namespace bricks::utility
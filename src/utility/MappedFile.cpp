@@ -0,0 +1,109 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <stdexcept>
+
+namespace bricks::utility {
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& filename)
+{
+    auto file = ::CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("File:" + filename + " could not be opened\n");
+    }
+
+    LARGE_INTEGER size{};
+    if (::GetFileSizeEx(file, &size) == 0) {
+        ::CloseHandle(file);
+        throw std::runtime_error("File:" + filename + " could not be read\n");
+    }
+    mSize = static_cast<std::size_t>(size.QuadPart);
+
+    if (mSize > 0) {
+        auto mapping =
+            ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        auto data = mapping != nullptr
+                        ? ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)
+                        : nullptr;
+        if (mapping != nullptr) {
+            ::CloseHandle(mapping);
+        }
+        if (data == nullptr) {
+            ::CloseHandle(file);
+            throw std::runtime_error("File:" + filename +
+                                     " could not be mapped\n");
+        }
+        mData = static_cast<const unsigned char*>(data);
+    }
+    // The view stays valid after the handles are closed
+    ::CloseHandle(file);
+}
+
+MappedFile::~MappedFile()
+{
+    if (mData) {
+        ::UnmapViewOfFile(mData);
+    }
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& filename)
+{
+    auto fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd == -1) {
+        throw std::runtime_error("File:" + filename + " could not be opened\n");
+    }
+
+    struct stat status {};
+    if (::fstat(fd, &status) == -1) {
+        ::close(fd);
+        throw std::runtime_error("File:" + filename + " could not be read\n");
+    }
+    mSize = static_cast<std::size_t>(status.st_size);
+
+    if (mSize > 0) {
+        auto data = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("File:" + filename +
+                                     " could not be mapped\n");
+        }
+        mData = static_cast<const unsigned char*>(data);
+    }
+    // The mapping stays valid after the descriptor is closed
+    ::close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (mData) {
+        ::munmap(const_cast<unsigned char*>(mData), mSize);
+    }
+}
+
+#endif
+
+const unsigned char* MappedFile::data() const
+{
+    return mData;
+}
+
+std::size_t MappedFile::size() const
+{
+    return mSize;
+}
+
+} // namespace bricks::utility
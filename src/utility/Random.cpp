@@ -0,0 +1,62 @@
+#include "Random.h"
+
+namespace bricks::utility {
+
+Random::Random(std::uint64_t seed)
+{
+    this->seed(seed);
+}
+
+void Random::seed(std::uint64_t seed)
+{
+    for (auto& state : mState) {
+        state = impl::splitMix64(seed);
+    }
+}
+
+Random::result_type Random::operator()()
+{
+    auto result = impl::rotateLeft(mState[1] * 5, 7) * 9;
+    auto t = mState[1] << 17U;
+
+    mState[2] ^= mState[0];
+    mState[3] ^= mState[1];
+    mState[1] ^= mState[2];
+    mState[0] ^= mState[3];
+
+    mState[2] ^= t;
+    mState[3] = impl::rotateLeft(mState[3], 45);
+
+    return result;
+}
+
+double Random::uniform(double min, double max)
+{
+    constexpr double scale = 1.0 / static_cast<double>(1ULL << 53U);
+    auto unit = static_cast<double>((*this)() >> 11U) * scale;
+    return min + unit * (max - min);
+}
+
+bool Random::chance(double probability)
+{
+    return uniform(0.0, 1.0) < probability;
+}
+
+namespace impl {
+
+std::uint64_t splitMix64(std::uint64_t& state)
+{
+    auto z = (state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30U)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27U)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31U);
+}
+
+std::uint64_t rotateLeft(std::uint64_t x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+} // namespace impl
+
+} // namespace bricks::utility
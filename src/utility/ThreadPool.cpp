@@ -0,0 +1,130 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace bricks::utility {
+
+ThreadPool::ThreadPool(std::size_t threadCount)
+{
+    threadCount = std::max<std::size_t>(threadCount, 1);
+
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        mQueues.push_back(std::make_unique<Queue>());
+    }
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        mThreads.emplace_back(&ThreadPool::work, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock{mMutex};
+        mStop = true;
+    }
+    mTaskQueued.notify_all();
+    for (auto& thread : mThreads) {
+        thread.join();
+    }
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+    std::lock_guard<std::mutex> lock{mMutex};
+
+    auto& queue = *mQueues[mNextQueue];
+    mNextQueue = (mNextQueue + 1) % mQueues.size();
+    {
+        std::lock_guard<std::mutex> queueLock{queue.mutex};
+        queue.tasks.push_back(std::move(task));
+    }
+    ++mQueuedCount;
+    ++mUnfinishedCount;
+    mTaskQueued.notify_one();
+}
+
+void ThreadPool::wait()
+{
+    std::unique_lock<std::mutex> lock{mMutex};
+    mAllFinished.wait(lock, [this]() { return mUnfinishedCount == 0; });
+
+    if (mException) {
+        auto exception = mException;
+        mException = nullptr;
+        std::rethrow_exception(exception);
+    }
+}
+
+std::size_t ThreadPool::threadCount() const
+{
+    return mThreads.size();
+}
+
+void ThreadPool::work(std::size_t queueIndex)
+{
+    while (true) {
+        std::function<void()> task;
+        if (popOwn(queueIndex, task) || steal(queueIndex, task)) {
+            std::exception_ptr exception;
+            try {
+                task();
+            }
+            catch (...) {
+                exception = std::current_exception();
+            }
+            finish(exception);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock{mMutex};
+        mTaskQueued.wait(lock,
+                         [this]() { return mStop || mQueuedCount > 0; });
+        if (mStop && mQueuedCount == 0) {
+            return;
+        }
+    }
+}
+
+bool ThreadPool::popOwn(std::size_t queueIndex, std::function<void()>& task)
+{
+    auto& queue = *mQueues[queueIndex];
+    std::lock_guard<std::mutex> lock{queue.mutex};
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    task = std::move(queue.tasks.front());
+    queue.tasks.pop_front();
+    --mQueuedCount;
+    return true;
+}
+
+bool ThreadPool::steal(std::size_t queueIndex, std::function<void()>& task)
+{
+    for (std::size_t i = 1; i < mQueues.size(); ++i) {
+        auto& queue = *mQueues[(queueIndex + i) % mQueues.size()];
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        if (queue.tasks.empty()) {
+            continue;
+        }
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        --mQueuedCount;
+        return true;
+    }
+    return false;
+}
+
+void ThreadPool::finish(std::exception_ptr exception)
+{
+    std::lock_guard<std::mutex> lock{mMutex};
+    if (exception && !mException) {
+        mException = exception;
+    }
+    --mUnfinishedCount;
+    if (mUnfinishedCount == 0) {
+        mAllFinished.notify_all();
+    }
+}
+
+} // namespace bricks::utility
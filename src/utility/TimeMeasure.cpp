@@ -12,11 +12,10 @@ double getElapsedTime(
     const std::chrono::time_point<std::chrono::high_resolution_clock>& first,
     const std::chrono::time_point<std::chrono::high_resolution_clock>& last)
 {
-    return static_cast<int>(
-        std::chrono::duration<double, std::milli>(last - first).count());
+    return std::chrono::duration<double, std::milli>(last - first).count();
 }
 
-void wait(const std::chrono::milliseconds& milliseconds)
+void wait(const std::chrono::duration<double, std::milli>& milliseconds)
 {
     std::this_thread::sleep_for(milliseconds);
 }
@@ -0,0 +1,106 @@
+#include "gtest/gtest.h"
+
+#include "../include/BatchRunner.h"
+
+#include "../include/utility/ThreadPool.h"
+
+#include "TestLevels.h"
+
+using namespace bricks;
+
+class BatchRunnerTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        settings.maxTicks = 3000;
+        for (std::uint64_t seed = 0; seed < 8; ++seed) {
+            jobs.push_back(BatchJob{DifficultyParameters{}, seed});
+        }
+    }
+
+    test::TemporaryLevels levelFiles{
+        "W 10 H 10\nX 4.0 Y 1.0 W 2.0 H 1.0 HP 1\n",
+        "W 10 H 10\nX 1.0 Y 1.0 W 2.0 H 1.0 HP 2\n"};
+    std::vector<std::string> levelFilenames = levelFiles.filenames();
+    std::vector<BatchJob> jobs;
+    BatchSettings settings;
+};
+
+TEST_F(BatchRunnerTest, runsEveryJob)
+{
+    utility::ThreadPool pool{4};
+
+    auto result = runBatch(levelFilenames, jobs, settings, pool);
+
+    EXPECT_EQ(result.games, 8);
+    ASSERT_FALSE(result.levels.empty());
+    EXPECT_GE(result.levels[0].starts, 8);
+    EXPECT_GT(result.ticks, 0);
+
+    long long levelTicks{0};
+    for (const auto& level : result.levels) {
+        levelTicks += level.ticks;
+        EXPECT_LE(level.completions, level.starts);
+    }
+    EXPECT_EQ(levelTicks, result.ticks);
+}
+
+TEST_F(BatchRunnerTest, resultDoesNotDependOnThreadCount)
+{
+    utility::ThreadPool onePool{1};
+    utility::ThreadPool fourPool{4};
+
+    auto a = runBatch(levelFilenames, jobs, settings, onePool);
+    auto b = runBatch(levelFilenames, jobs, settings, fourPool);
+
+    EXPECT_EQ(a.ticks, b.ticks);
+    EXPECT_EQ(a.gameOvers, b.gameOvers);
+    ASSERT_EQ(a.levels.size(), b.levels.size());
+    for (std::size_t i = 0; i < a.levels.size(); ++i) {
+        EXPECT_EQ(a.levels[i].starts, b.levels[i].starts);
+        EXPECT_EQ(a.levels[i].completions, b.levels[i].completions);
+        EXPECT_EQ(a.levels[i].lostBalls, b.levels[i].lostBalls);
+        EXPECT_EQ(a.levels[i].score, b.levels[i].score);
+    }
+}
+
+TEST_F(BatchRunnerTest, jobCountsLevelsAndScore)
+{
+    auto result = runBatchJob(levelFilenames, jobs.front(), settings);
+
+    long long score{0};
+    for (const auto& level : result.levels) {
+        score += level.score;
+    }
+    EXPECT_EQ(result.games, 1);
+    EXPECT_GT(score, 0);
+    if (result.levels.size() > 1) {
+        EXPECT_EQ(result.levels[1].starts, result.levels[0].completions);
+    }
+}
+
+TEST(BatchResult, merge)
+{
+    BatchResult a;
+    a.games = 1;
+    a.ticks = 10;
+    a.levels.resize(1);
+    a.levels[0].starts = 1;
+
+    BatchResult b;
+    b.games = 2;
+    b.gameOvers = 1;
+    b.ticks = 5;
+    b.levels.resize(2);
+    b.levels[0].starts = 2;
+    b.levels[1].lostBalls = 3;
+
+    merge(a, b);
+
+    EXPECT_EQ(a.games, 3);
+    EXPECT_EQ(a.gameOvers, 1);
+    EXPECT_EQ(a.ticks, 15);
+    ASSERT_EQ(a.levels.size(), 2);
+    EXPECT_EQ(a.levels[0].starts, 3);
+    EXPECT_EQ(a.levels[1].lostBalls, 3);
+}
@@ -0,0 +1,60 @@
+#include "gtest/gtest.h"
+
+#include "../include/DirtyRegions.h"
+
+using namespace bricks;
+
+TEST(DirtyRegions, IgnoresEmptyRects)
+{
+    DirtyRegions regions;
+
+    regions.add(ScreenRect{1, 1, 0, 5});
+    regions.add(ScreenRect{1, 1, 5, -1});
+
+    EXPECT_TRUE(regions.empty());
+}
+
+TEST(DirtyRegions, KeepsSeparateRects)
+{
+    DirtyRegions regions;
+
+    regions.add(ScreenRect{0, 0, 10, 10});
+    regions.add(ScreenRect{10, 0, 10, 10});
+
+    ASSERT_EQ(regions.rects().size(), 2);
+    EXPECT_EQ(regions.rects()[0], (ScreenRect{0, 0, 10, 10}));
+    EXPECT_EQ(regions.rects()[1], (ScreenRect{10, 0, 10, 10}));
+}
+
+TEST(DirtyRegions, MergesOverlappingRects)
+{
+    DirtyRegions regions;
+
+    regions.add(ScreenRect{0, 0, 10, 10});
+    regions.add(ScreenRect{5, 5, 10, 10});
+
+    ASSERT_EQ(regions.rects().size(), 1);
+    EXPECT_EQ(regions.rects()[0], (ScreenRect{0, 0, 15, 15}));
+}
+
+TEST(DirtyRegions, MergesChainOfRects)
+{
+    DirtyRegions regions;
+
+    regions.add(ScreenRect{0, 0, 10, 10});
+    regions.add(ScreenRect{20, 0, 10, 10});
+    regions.add(ScreenRect{8, 0, 14, 2});
+
+    ASSERT_EQ(regions.rects().size(), 1);
+    EXPECT_EQ(regions.rects()[0], (ScreenRect{0, 0, 30, 10}));
+}
+
+TEST(DirtyRegions, Clear)
+{
+    DirtyRegions regions;
+
+    regions.add(ScreenRect{0, 0, 10, 10});
+    regions.clear();
+
+    EXPECT_TRUE(regions.empty());
+}
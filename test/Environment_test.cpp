@@ -0,0 +1,209 @@
+#include "gtest/gtest.h"
+
+#include "../include/Environment.h"
+#include "../include/LevelCache.h"
+
+#include "../include/types/Real.h"
+#include "../include/utility/ThreadPool.h"
+
+#include "TestLevels.h"
+
+#include <type_traits>
+
+using namespace bricks;
+
+class EnvironmentTest : public ::testing::Test {
+protected:
+    test::TemporaryLevels levelFiles{
+        "W 10 H 10\nX 4.0 Y 1.0 W 2.0 H 1.0 HP 1\n",
+        "W 10 H 10\nX 1.0 Y 1.0 W 2.0 H 1.0 HP 2\n"
+        "X 6.0 Y 1.0 W 2.0 H 1.0 HP 3\n"};
+    std::shared_ptr<LevelCache> levels{
+        std::make_shared<LevelCache>(levelFiles.filenames())};
+};
+
+TEST_F(EnvironmentTest, observationHasRoomForLargestLevel)
+{
+    Environment environment{levels};
+
+    EXPECT_EQ(environment.observationSize(),
+              Environment::observationHeaderSize + 2);
+}
+
+TEST_F(EnvironmentTest, observesLevel)
+{
+    Environment environment{levels};
+    std::vector<float> observation(environment.observationSize(), -1.0F);
+
+    environment.observe(observation.data(), observation.size());
+
+    const auto& level = environment.simulation().level();
+    EXPECT_FLOAT_EQ(observation[0], static_cast<float>(level.ball.topLeft().x));
+    EXPECT_FLOAT_EQ(observation[1], static_cast<float>(level.ball.topLeft().y));
+    EXPECT_FLOAT_EQ(observation[4], 0.0F);
+    EXPECT_FLOAT_EQ(observation[5],
+                    static_cast<float>(level.platform.topLeft().x));
+    EXPECT_FLOAT_EQ(observation[7], static_cast<float>(level.platform.width()));
+    EXPECT_FLOAT_EQ(observation[8], static_cast<float>(level.gridWidth()));
+    EXPECT_FLOAT_EQ(observation[10], 1.0F);
+    EXPECT_FLOAT_EQ(observation[11], 0.0F);
+}
+
+TEST_F(EnvironmentTest, launchActivatesBall)
+{
+    Environment environment{levels};
+    std::vector<float> observation(environment.observationSize());
+
+    auto result = environment.step(Action::launch, 1);
+    environment.observe(observation.data(), observation.size());
+
+    EXPECT_EQ(result.reward, 0);
+    EXPECT_FALSE(result.done);
+    EXPECT_EQ(result.lifes, 5);
+    EXPECT_FLOAT_EQ(observation[4], 1.0F);
+}
+
+TEST_F(EnvironmentTest, stepsUntilDone)
+{
+    Environment environment{levels};
+
+    StepResult result;
+    int steps = 0;
+    while (!result.done && steps < 10000) {
+        result = environment.step(Action::launch, 10);
+        ++steps;
+    }
+
+    EXPECT_TRUE(result.done);
+    EXPECT_EQ(result.lifes, 0);
+
+    environment.reset(1);
+    EXPECT_FALSE(environment.simulation().isGameOver());
+    EXPECT_EQ(environment.simulation().lifes(), 5);
+}
+
+TEST_F(EnvironmentTest, rewardIsScoreGained)
+{
+    Environment environment{levels};
+
+    long long rewards{0};
+    for (int i = 0; i < 2000; ++i) {
+        auto result = environment.step(Action::launch, 1);
+        rewards += result.reward;
+        if (result.done) {
+            break;
+        }
+    }
+
+    EXPECT_EQ(rewards, environment.simulation().score());
+}
+
+TEST_F(EnvironmentTest, sameSeedSameGame)
+{
+    Environment first{levels};
+    Environment second{levels};
+    first.reset(42);
+    second.reset(42);
+
+    for (int i = 0; i < 500; ++i) {
+        auto action = i % 3 == 0 ? Action::left : Action::launch;
+        auto firstResult = first.step(action, 2);
+        auto secondResult = second.step(action, 2);
+        EXPECT_EQ(firstResult.reward, secondResult.reward);
+        EXPECT_EQ(firstResult.lifes, secondResult.lifes);
+    }
+    EXPECT_EQ(first.simulation().level().ball.topLeft().x,
+              second.simulation().level().ball.topLeft().x);
+}
+
+TEST_F(EnvironmentTest, vectorEnvironmentWithPoolMatchesWithout)
+{
+    utility::ThreadPool pool{3};
+    VectorEnvironment serial{levels, 8};
+    VectorEnvironment parallel{levels, 8, {}, 16.0, &pool};
+
+    std::vector<std::uint64_t> seeds{0, 1, 2, 3, 4, 5, 6, 7};
+    serial.reset(seeds);
+    parallel.reset(seeds);
+
+    std::vector<Action> actions(8, Action::launch);
+    std::vector<StepResult> serialResults;
+    std::vector<StepResult> parallelResults;
+    for (int i = 0; i < 200; ++i) {
+        actions[static_cast<std::size_t>(i % 8)] = Action::right;
+        serial.step(actions, 3, serialResults);
+        parallel.step(actions, 3, parallelResults);
+        ASSERT_EQ(serialResults.size(), 8u);
+        ASSERT_EQ(parallelResults.size(), 8u);
+        for (std::size_t k = 0; k < 8; ++k) {
+            EXPECT_EQ(serialResults[k].reward, parallelResults[k].reward);
+            EXPECT_EQ(serialResults[k].lifes, parallelResults[k].lifes);
+        }
+    }
+
+    auto size = serial.size() * serial.observationSize();
+    std::vector<float> serialObservations(size);
+    std::vector<float> parallelObservations(size);
+    serial.observe(serialObservations.data(), size);
+    parallel.observe(parallelObservations.data(), size);
+    EXPECT_EQ(serialObservations, parallelObservations);
+}
+
+TEST_F(EnvironmentTest, vectorEnvironmentMatchesSingleEnvironments)
+{
+    if (!std::is_same_v<types::Real, double>) {
+        GTEST_SKIP() << "BallBatch<double> moves like Ball::move only with "
+                        "types::Real double";
+    }
+
+    VectorEnvironment environments{levels, 5};
+    std::vector<std::unique_ptr<Environment>> singles;
+    std::vector<std::uint64_t> seeds;
+    for (std::uint64_t seed = 0; seed < 5; ++seed) {
+        singles.push_back(std::make_unique<Environment>(levels));
+        singles.back()->reset(seed);
+        seeds.push_back(seed);
+    }
+    environments.reset(seeds);
+
+    std::vector<Action> actions(5, Action::launch);
+    std::vector<StepResult> results;
+    for (int i = 0; i < 300; ++i) {
+        actions[static_cast<std::size_t>(i % 5)] =
+            i % 2 == 0 ? Action::left : Action::right;
+        environments.step(actions, 4, results);
+        for (std::size_t k = 0; k < 5; ++k) {
+            auto single = singles[k]->step(actions[k], 4);
+            EXPECT_EQ(results[k].reward, single.reward);
+            EXPECT_EQ(results[k].done, single.done);
+            EXPECT_EQ(results[k].lifes, single.lifes);
+
+            const auto& ball = environments[k].simulation().level().ball;
+            const auto& singleBall = singles[k]->simulation().level().ball;
+            ASSERT_EQ(ball.topLeft().x, singleBall.topLeft().x);
+            ASSERT_EQ(ball.topLeft().y, singleBall.topLeft().y);
+        }
+    }
+}
+
+TEST_F(EnvironmentTest, vectorEnvironmentObservesOneAfterTheOther)
+{
+    VectorEnvironment environments{levels, 3};
+    auto observationSize = environments.observationSize();
+    std::vector<float> observations(3 * observationSize);
+    std::vector<StepResult> results;
+
+    environments.step({Action::none, Action::left, Action::right}, 5, results);
+    environments.observe(observations.data(), observations.size());
+
+    for (std::size_t k = 0; k < 3; ++k) {
+        std::vector<float> observation(observationSize);
+        environments[k].observe(observation.data(), observation.size());
+        EXPECT_TRUE(std::equal(observation.begin(), observation.end(),
+                               observations.begin() +
+                                   static_cast<std::ptrdiff_t>(
+                                       k * observationSize)));
+    }
+    EXPECT_LT(observations[observationSize + 5], observations[5]);
+    EXPECT_GT(observations[2 * observationSize + 5], observations[5]);
+}
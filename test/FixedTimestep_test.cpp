@@ -0,0 +1,83 @@
+#include "gtest/gtest.h"
+
+#include "../include/FixedTimestep.h"
+
+#include "../include/types/Point.h"
+
+#include <stdexcept>
+
+using namespace bricks;
+
+using Point = types::Point;
+
+TEST(FixedTimestep, ThrowsOnInvalidTick)
+{
+    EXPECT_THROW(FixedTimestep{0.0}, std::invalid_argument);
+    EXPECT_THROW(FixedTimestep{-1.0}, std::invalid_argument);
+    EXPECT_THROW((FixedTimestep{10.0, 5.0}), std::invalid_argument);
+}
+
+TEST(FixedTimestep, AdvanceAccumulatesPartialTicks)
+{
+    FixedTimestep timestep{10.0};
+
+    EXPECT_EQ(timestep.advance(4.0), 0);
+    EXPECT_NEAR(timestep.alpha(), 0.4, 1e-9);
+    EXPECT_EQ(timestep.advance(7.0), 1);
+    EXPECT_NEAR(timestep.alpha(), 0.1, 1e-9);
+    EXPECT_EQ(timestep.advance(0.5), 0);
+    EXPECT_NEAR(timestep.alpha(), 0.15, 1e-9);
+}
+
+TEST(FixedTimestep, AdvanceReturnsAllDueTicks)
+{
+    FixedTimestep timestep{10.0};
+
+    EXPECT_EQ(timestep.advance(35.0), 3);
+    EXPECT_NEAR(timestep.alpha(), 0.5, 1e-9);
+}
+
+TEST(FixedTimestep, AdvanceDropsTimeAboveMaxFrame)
+{
+    FixedTimestep timestep{10.0, 50.0};
+
+    EXPECT_EQ(timestep.advance(1000.0), 5);
+    EXPECT_NEAR(timestep.alpha(), 0.0, 1e-9);
+}
+
+TEST(FixedTimestep, AdvanceIgnoresNegativeTime)
+{
+    FixedTimestep timestep{10.0};
+
+    EXPECT_EQ(timestep.advance(-5.0), 0);
+    EXPECT_NEAR(timestep.alpha(), 0.0, 1e-9);
+}
+
+TEST(FixedTimestep, ShortFramesAddUpToTicks)
+{
+    FixedTimestep timestep{1000.0 / 60.0};
+
+    int ticks{0};
+    for (int frame = 0; frame < 251; ++frame) {
+        ticks += timestep.advance(4.0);
+    }
+    EXPECT_EQ(ticks, 60);
+}
+
+TEST(Interpolate, BetweenPreviousAndCurrent)
+{
+    Point previous{1.0, 2.0};
+    Point current{3.0, 6.0};
+
+    auto p = interpolate(previous, current, 0.25);
+    EXPECT_DOUBLE_EQ(p.x, 1.5);
+    EXPECT_DOUBLE_EQ(p.y, 3.0);
+
+    p = interpolate(previous, current, 0.0);
+    EXPECT_DOUBLE_EQ(p.x, previous.x);
+    EXPECT_DOUBLE_EQ(p.y, previous.y);
+
+    p = interpolate(previous, current, 1.0);
+    EXPECT_DOUBLE_EQ(p.x, current.x);
+    EXPECT_DOUBLE_EQ(p.y, current.y);
+}
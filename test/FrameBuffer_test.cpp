@@ -0,0 +1,135 @@
+#include "gtest/gtest.h"
+
+#include "../include/FrameBuffer.h"
+
+#include "../include/types/RGBColor.h"
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+using namespace bricks;
+using namespace bricks::types;
+
+TEST(FrameBuffer, Constructor)
+{
+    FrameBuffer frameBuffer{3, 2};
+
+    EXPECT_EQ(frameBuffer.width(), 3);
+    EXPECT_EQ(frameBuffer.height(), 2);
+    EXPECT_EQ(frameBuffer.pixels().size(), 6);
+}
+
+TEST(FrameBuffer, ConstructorThrowsOnEmptySize)
+{
+    EXPECT_THROW((FrameBuffer{0, 2}), std::invalid_argument);
+    EXPECT_THROW((FrameBuffer{2, -1}), std::invalid_argument);
+}
+
+TEST(FrameBuffer, Clear)
+{
+    FrameBuffer frameBuffer{7, 5};
+
+    frameBuffer.clear(42);
+
+    for (auto pixel : frameBuffer.pixels()) {
+        EXPECT_EQ(pixel, 42);
+    }
+}
+
+TEST(FrameBuffer, FillRect)
+{
+    FrameBuffer frameBuffer{20, 10};
+    frameBuffer.clear(0);
+
+    frameBuffer.fillRect(ScreenRect{2, 3, 11, 4}, 7);
+
+    for (int y = 0; y < frameBuffer.height(); ++y) {
+        for (int x = 0; x < frameBuffer.width(); ++x) {
+            auto inside = x >= 2 && x < 13 && y >= 3 && y < 7;
+            EXPECT_EQ(frameBuffer.pixel(x, y), inside ? 7 : 0)
+                << "x " << x << " y " << y;
+        }
+    }
+}
+
+TEST(FrameBuffer, FillRectIsClipped)
+{
+    FrameBuffer frameBuffer{4, 4};
+    frameBuffer.clear(0);
+
+    frameBuffer.fillRect(ScreenRect{-2, -2, 4, 4}, 1);
+    frameBuffer.fillRect(ScreenRect{3, 3, 10, 10}, 2);
+    frameBuffer.fillRect(ScreenRect{10, 0, 2, 2}, 3);
+
+    EXPECT_EQ(frameBuffer.pixel(0, 0), 1);
+    EXPECT_EQ(frameBuffer.pixel(1, 1), 1);
+    EXPECT_EQ(frameBuffer.pixel(2, 2), 0);
+    EXPECT_EQ(frameBuffer.pixel(3, 3), 2);
+    EXPECT_EQ(frameBuffer.pixel(3, 0), 0);
+}
+
+TEST(FrameBuffer, PixelThrowsOutside)
+{
+    FrameBuffer frameBuffer{4, 4};
+
+    EXPECT_THROW(frameBuffer.pixel(4, 0), std::out_of_range);
+    EXPECT_THROW(frameBuffer.pixel(0, -1), std::out_of_range);
+}
+
+TEST(FrameBuffer, ToPixelKeepsByteOrder)
+{
+    auto pixel = toPixel(RGBColor{0x11, 0x22, 0x33, 0x44});
+    auto bytes = reinterpret_cast<const unsigned char*>(&pixel);
+
+    EXPECT_EQ(bytes[0], 0x11);
+    EXPECT_EQ(bytes[1], 0x22);
+    EXPECT_EQ(bytes[2], 0x33);
+    EXPECT_EQ(bytes[3], 0x44);
+
+    auto color = toRGBColor(pixel);
+    EXPECT_EQ(color.r(), 0x11);
+    EXPECT_EQ(color.g(), 0x22);
+    EXPECT_EQ(color.b(), 0x33);
+    EXPECT_EQ(color.a(), 0x44);
+}
+
+TEST(FrameBuffer, WritePPM)
+{
+    FrameBuffer frameBuffer{2, 1};
+    frameBuffer.fillRect(ScreenRect{0, 0, 1, 1},
+                         toPixel(RGBColor{1, 2, 3}));
+    frameBuffer.fillRect(ScreenRect{1, 0, 1, 1},
+                         toPixel(RGBColor{4, 5, 6}));
+
+    std::ostringstream oss;
+    writePPM(oss, frameBuffer);
+
+    EXPECT_EQ(oss.str(), std::string("P6\n2 1\n255\n\x01\x02\x03\x04\x05\x06"));
+}
+
+TEST(FrameBuffer, WriteRaw)
+{
+    FrameBuffer frameBuffer{1, 1};
+    frameBuffer.clear(toPixel(RGBColor{1, 2, 3, 4}));
+
+    std::ostringstream oss;
+    writeRaw(oss, frameBuffer);
+
+    EXPECT_EQ(oss.str(), std::string("\x01\x02\x03\x04"));
+}
+
+TEST(FillSpan, FillsEveryLength)
+{
+    for (std::size_t count = 0; count < 20; ++count) {
+        std::vector<std::uint32_t> pixels(count + 2, 0);
+
+        bricks::impl::fillSpan(&pixels[1], count, 9);
+
+        EXPECT_EQ(pixels.front(), 0);
+        EXPECT_EQ(pixels.back(), 0);
+        for (std::size_t i = 1; i <= count; ++i) {
+            EXPECT_EQ(pixels[i], 9);
+        }
+    }
+}
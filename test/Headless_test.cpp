@@ -0,0 +1,135 @@
+#include "gtest/gtest.h"
+
+#include "../include/Headless.h"
+#include "../include/Simulation.h"
+#include "../include/utility/OperatorDegree.h"
+
+#include "TestLevels.h"
+
+#include <sstream>
+
+using namespace bricks;
+
+using Event = InputHandler::Event;
+
+class HeadlessTest : public ::testing::Test {
+protected:
+    test::TemporaryLevels levelFiles{
+        "W 10 H 10\nX 4.0 Y 1.0 W 2.0 H 1.0 HP 1\n"};
+    std::string levelFilename = levelFiles.filenames().front();
+};
+
+TEST_F(HeadlessTest, stopsAfterMaxTicks)
+{
+    Simulation simulation{{levelFilename}};
+
+    auto result = runHeadless(
+        simulation, [](const Level&) { return Event::none; }, 100);
+
+    EXPECT_EQ(result.ticks, 100);
+    EXPECT_FALSE(result.gameOver);
+    EXPECT_EQ(result.lifes, 5);
+}
+
+TEST_F(HeadlessTest, stopsOnGameOver)
+{
+    Simulation simulation{{levelFilename}};
+
+    auto result = runHeadless(
+        simulation, [](const Level&) { return Event::space; }, 1000000);
+
+    EXPECT_LT(result.ticks, 1000000);
+    EXPECT_TRUE(result.gameOver);
+    EXPECT_EQ(result.lifes, 0);
+}
+
+TEST_F(HeadlessTest, scriptedInput)
+{
+    Simulation simulation{{levelFilename}};
+
+    auto result = runHeadless(
+        simulation, makeScriptedInput({Event::none, Event::escape}), 100);
+
+    EXPECT_EQ(result.ticks, 2);
+    EXPECT_TRUE(simulation.isQuit());
+}
+
+TEST_F(HeadlessTest, followBallKeepsBallInPlay)
+{
+    Simulation simulation{{levelFilename}};
+
+    auto result = runHeadless(simulation, followBall, 2000);
+
+    EXPECT_EQ(result.lifes, 5);
+}
+
+TEST_F(HeadlessTest, withoutDeviationSeedChangesNothing)
+{
+    auto play = [this](std::uint64_t seed) {
+        Simulation simulation{{levelFilename}, 0, DifficultyParameters{}, seed};
+        runHeadless(simulation, followBall, 5000);
+        return simulation.level().ball.topLeft();
+    };
+
+    auto first = play(7);
+    auto other = play(8);
+
+    EXPECT_EQ(first.x, other.x);
+    EXPECT_EQ(first.y, other.y);
+}
+
+TEST_F(HeadlessTest, sameSeedPlaysSameGame)
+{
+    auto play = [this](std::uint64_t seed) {
+        Simulation simulation{{levelFilename}, 0, DifficultyParameters{}, seed,
+                              utility::deg2rad(2.0)};
+        runHeadless(simulation, followBall, 5000);
+        return simulation.level().ball.topLeft();
+    };
+
+    auto first = play(7);
+    auto second = play(7);
+    auto other = play(8);
+
+    EXPECT_EQ(first.x, second.x);
+    EXPECT_EQ(first.y, second.y);
+    EXPECT_TRUE(first.x != other.x || first.y != other.y);
+}
+
+TEST_F(HeadlessTest, onTickIsCalledAfterEveryStep)
+{
+    Simulation simulation{{levelFilename}};
+    long long calls{0};
+
+    auto result = runHeadless(
+        simulation, [](const Level&) { return Event::none; }, 50, 16.0,
+        [&calls](const Simulation&) { ++calls; });
+
+    EXPECT_EQ(calls, result.ticks);
+}
+
+TEST_F(HeadlessTest, frameCaptureWritesOneFramePerTick)
+{
+    Simulation simulation{{levelFilename}};
+    std::ostringstream oss;
+
+    runHeadless(
+        simulation, [](const Level&) { return Event::none; }, 3, 16.0,
+        makeFrameCapture(oss, FrameFormat::raw, 40, 30));
+
+    EXPECT_EQ(oss.str().size(), 3 * 40 * 30 * 4);
+}
+
+TEST_F(HeadlessTest, frameCaptureWritesPPM)
+{
+    Simulation simulation{{levelFilename}};
+    std::ostringstream oss;
+
+    runHeadless(
+        simulation, [](const Level&) { return Event::none; }, 2, 16.0,
+        makeFrameCapture(oss, FrameFormat::ppm, 40, 30));
+
+    std::string header{"P6\n40 30\n255\n"};
+    EXPECT_EQ(oss.str().size(), 2 * (header.size() + 40 * 30 * 3));
+    EXPECT_EQ(oss.str().substr(0, header.size()), header);
+}
@@ -0,0 +1,103 @@
+#include "gtest/gtest.h"
+
+#include "../include/LevelCache.h"
+
+#include "TestLevels.h"
+
+#include <filesystem>
+#include <stdexcept>
+#include <thread>
+
+using namespace bricks;
+
+class LevelCacheTest : public ::testing::Test {
+protected:
+    test::TemporaryLevels levelFiles{
+        "W 10 H 10\nX 4.0 Y 1.0 W 2.0 H 1.0 HP 1\n",
+        "W 10 H 10\nX 1.0 Y 1.0 W 2.0 H 1.0 HP 2\n"
+        "X 5.0 Y 1.0 W 2.0 H 1.0 HP 3\n"};
+    std::vector<std::string> levelFilenames = levelFiles.filenames();
+};
+
+TEST_F(LevelCacheTest, returnsLevels)
+{
+    LevelCache cache{levelFilenames};
+
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.level(1).bricks.size(), 1);
+    EXPECT_EQ(cache.level(2).bricks.size(), 2);
+}
+
+TEST_F(LevelCacheTest, readsEveryFileOnlyOnce)
+{
+    LevelCache cache{levelFilenames};
+    cache.prefetch(2);
+    cache.level(1);
+    cache.level(2);
+
+    for (const auto& filename : levelFilenames) {
+        std::filesystem::remove(filename);
+    }
+
+    EXPECT_EQ(cache.level(1).bricks.size(), 1);
+    EXPECT_EQ(cache.level(2).bricks.size(), 2);
+}
+
+TEST_F(LevelCacheTest, returnsIndependentCopies)
+{
+    LevelCache cache{levelFilenames};
+
+    auto level = cache.level(2);
+    level.hitBrick(0);
+
+    auto fresh = cache.level(2);
+    EXPECT_EQ(fresh.bricks[0].hitpoints(), 2);
+    EXPECT_EQ(fresh.aliveBrickCount(), 2);
+}
+
+TEST_F(LevelCacheTest, maxBrickCount)
+{
+    LevelCache cache{levelFilenames};
+
+    EXPECT_EQ(cache.maxBrickCount(), 2);
+    EXPECT_EQ(LevelCache{{}}.maxBrickCount(), 0);
+}
+
+TEST_F(LevelCacheTest, levelOutOfRangeThrows)
+{
+    LevelCache cache{levelFilenames};
+
+    EXPECT_THROW(cache.level(0), std::out_of_range);
+    EXPECT_THROW(cache.level(3), std::out_of_range);
+    EXPECT_THROW(cache.prefetch(3), std::out_of_range);
+}
+
+TEST_F(LevelCacheTest, loadErrorsAreRethrown)
+{
+    LevelCache cache{{"does_not_exist.lvl"}};
+
+    cache.prefetch(1);
+    EXPECT_THROW(cache.level(1), std::runtime_error);
+}
+
+TEST_F(LevelCacheTest, concurrentRequests)
+{
+    LevelCache cache{levelFilenames};
+
+    std::vector<std::thread> threads;
+    std::vector<std::size_t> brickCounts(8);
+    for (std::size_t i = 0; i < brickCounts.size(); ++i) {
+        threads.emplace_back([&cache, &brickCounts, i]() {
+            cache.prefetch(2);
+            brickCounts[i] = cache.level(static_cast<int>(i % 2) + 1)
+                                 .bricks.size();
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (std::size_t i = 0; i < brickCounts.size(); ++i) {
+        EXPECT_EQ(brickCounts[i], i % 2 + 1);
+    }
+}
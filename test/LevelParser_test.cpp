@@ -0,0 +1,95 @@
+#include "gtest/gtest.h"
+
+#include "../include/Level.h"
+#include "../include/LevelParser.h"
+
+#include <sstream>
+#include <string>
+#include <tuple>
+
+using namespace bricks;
+
+TEST(LevelParser, parsesBricksAndIndestructibleBricks)
+{
+    auto level = parseLevel("# comment before the size\n"
+                            "W 10 H 20\r\n"
+                            "\n"
+                            "  # indented comment\n"
+                            "X 1.2 Y 3.4 W 5.6 H 7.8 HP 9\n"
+                            "X\t9.8   Y 7.6 W 5.4 H 3.2");
+
+    auto wallThickness = level.leftWall().width();
+    EXPECT_EQ(level.gridWidth(), 10 + 2 * wallThickness);
+    EXPECT_EQ(level.gridHeight(), 20 + wallThickness);
+
+    ASSERT_EQ(level.bricks.size(), 1);
+    EXPECT_EQ(level.bricks[0].topLeft().x, 1.2 + wallThickness);
+    EXPECT_EQ(level.bricks[0].topLeft().y, 3.4 + wallThickness);
+    EXPECT_EQ(level.bricks[0].width(), 5.6);
+    EXPECT_EQ(level.bricks[0].height(), 7.8);
+    EXPECT_EQ(level.bricks[0].hitpoints(), 9);
+
+    ASSERT_EQ(level.indestructibleBricks.size(), 1);
+    EXPECT_EQ(level.indestructibleBricks[0].topLeft().x, 9.8 + wallThickness);
+    EXPECT_EQ(level.indestructibleBricks[0].height(), 3.2);
+}
+
+TEST(LevelParser, matchesStreamOperator)
+{
+    std::string text{"W 26 H 18\nX 4.0 Y 2.0 W 3.0 H 1.0 HP 1\n"
+                     "X 7.5 Y 2.25 W 3.0 H 1.0 HP 2\n"};
+    std::istringstream ist{text};
+    Level streamed;
+    ist >> streamed;
+    auto parsed = parseLevel(text);
+
+    ASSERT_EQ(parsed.bricks.size(), streamed.bricks.size());
+    for (std::size_t i = 0; i < parsed.bricks.size(); ++i) {
+        EXPECT_EQ(parsed.bricks[i].topLeft().x, streamed.bricks[i].topLeft().x);
+        EXPECT_EQ(parsed.bricks[i].topLeft().y, streamed.bricks[i].topLeft().y);
+    }
+}
+
+class LevelParserErrorParametersTests
+    : public ::testing::TestWithParam<std::tuple<std::string, int, int>> {
+protected:
+};
+
+TEST_P(LevelParserErrorParametersTests, reportsLineAndColumn)
+{
+    auto text = std::get<0>(GetParam());
+    auto line = std::get<1>(GetParam());
+    auto column = std::get<2>(GetParam());
+
+    try {
+        parseLevel(text, "test.lvl");
+        FAIL() << "no error for: " << text;
+    }
+    catch (const LevelParseError& e) {
+        EXPECT_EQ(e.line(), line) << e.what();
+        EXPECT_EQ(e.column(), column) << e.what();
+        EXPECT_EQ(std::string{e.what()}.rfind("test.lvl:", 0), 0);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    LevelParserErrorTests, LevelParserErrorParametersTests,
+    ::testing::Values(
+        std::make_tuple("", 1, 1), std::make_tuple("# only comment\n", 1, 1),
+        std::make_tuple("X 10 H 20\n", 1, 1),
+        std::make_tuple("W ten H 20\n", 1, 3),
+        std::make_tuple("W 10 H 20 Z\n", 1, 11),
+        std::make_tuple("W -1 H 20\n", 1, 3),
+        std::make_tuple("W inf H 20\n", 1, 3),
+        std::make_tuple("W 10 H nan\n", 1, 8),
+        std::make_tuple("W 10 H 20\nX nan Y 1 W 2 H 1 HP 1\n", 2, 3),
+        std::make_tuple("W 10 H 20\nX 1 Y inf W 2 H 1 HP 1\n", 2, 7),
+        std::make_tuple("W 10 H 20\nX 1 Y 1 W -inf H 1 HP 1\n", 2, 11),
+        std::make_tuple("W 10 H 20\n\nX 1.0 Y 1.0 W 1.0 H 1.0 HP\n", 3, 27),
+        std::make_tuple("W 10 H 20\nX 1.0 Y 1.0 W 1.0 H 1.0 HP 10\n", 2, 28),
+        std::make_tuple("W 10 H 20\nX 1.0 Y 1.0 W 1.0 H 1.0 XP 1\n", 2, 25),
+        std::make_tuple("W 10 H 20\nX 11.0 Y 1.0 W 1.0 H 1.0\n", 2, 3),
+        std::make_tuple("W 10 H 20\nX 1.0 Y -1.0 W 1.0 H 1.0\n", 2, 9),
+        std::make_tuple("W 10 H 20\nX 1.0 Y 1.0 W -1 H 1.0\n", 2, 15),
+        std::make_tuple("W 10 H 20\nX 1.0 Y 1.0 W 1.0 H 1.0 HP 1 2\n", 2,
+                        30)));
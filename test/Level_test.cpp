@@ -1,9 +1,18 @@
 #include "gtest/gtest.h"
 
 #include "../include/Level.h"
+#include "../include/types/GridHeight.h"
+#include "../include/types/GridWidth.h"
 
+#include "TestLevels.h"
+
+#include <cstddef>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <limits>
 #include <sstream>
+#include <stdexcept>
 
 using namespace bricks;
 
@@ -56,3 +65,210 @@ X 9.8 Y 7.6 W 5.4 H 3.2
     EXPECT_EQ(indestructibleBricks[0].width(), 5.4);
     EXPECT_EQ(indestructibleBricks[0].height(), 3.2);
 }
+
+TEST(LevelTest, countsAliveBricks)
+{
+    using namespace bricks::game_objects;
+    using namespace bricks::types;
+
+    std::vector<Brick> bricks{
+        Brick{Point{1.0, 1.0}, Width{1.0}, Height{1.0}, Hitpoints{1}},
+        Brick{Point{3.0, 1.0}, Width{1.0}, Height{1.0}, Hitpoints{2}}};
+    bricks[0].decreaseHitpoints();
+
+    Level level{DifficultyParameters{}, GridWidth{10}, GridHeight{10}, bricks,
+                std::vector<IndestructibleBrick>{}};
+
+    EXPECT_EQ(level.aliveBrickCount(), 1);
+    EXPECT_FALSE(level.allBricksDestroyed());
+
+    level.hitBrick(1);
+    EXPECT_EQ(level.aliveBrickCount(), 1);
+    level.hitBrick(1);
+    EXPECT_EQ(level.aliveBrickCount(), 0);
+    EXPECT_TRUE(level.allBricksDestroyed());
+}
+
+TEST(LevelTest, reflectBallCountsDestroyedBricks)
+{
+    using namespace bricks::game_objects;
+    using namespace bricks::types;
+
+    std::vector<Brick> bricks{
+        Brick{Point{1.0, 1.0}, Width{2.0}, Height{1.0}, Hitpoints{1}}};
+    Level level{DifficultyParameters{}, GridWidth{10}, GridHeight{10}, bricks,
+                std::vector<IndestructibleBrick>{}};
+    level.ball.setTopLeft(level.bricks[0].topLeft());
+
+    std::vector<Hit> hits;
+    level.reflectBall(hits);
+
+    ASSERT_EQ(hits.size(), 1);
+    EXPECT_TRUE(level.bricks[0].isDestroyed());
+    EXPECT_EQ(level.aliveBrickCount(), 0);
+    EXPECT_TRUE(level.allBricksDestroyed());
+}
+
+TEST(LevelTest, resetRestoresStart)
+{
+    using namespace bricks::game_objects;
+    using namespace bricks::types;
+
+    std::vector<Brick> bricks{
+        Brick{Point{1.0, 1.0}, Width{1.0}, Height{1.0}, Hitpoints{1}},
+        Brick{Point{3.0, 1.0}, Width{1.0}, Height{1.0}, Hitpoints{2}}};
+    Level level{DifficultyParameters{}, GridWidth{10}, GridHeight{10}, bricks,
+                std::vector<IndestructibleBrick>{}};
+    auto ballStart = level.ball.topLeft();
+    auto platformStart = level.platform.topLeft();
+    const auto* brickData = level.bricks.data();
+
+    for (std::size_t i = 0; i < level.bricks.size(); ++i) {
+        level.hitBrick(i);
+    }
+    level.ball.activate();
+    level.ball.move(100.0);
+    level.platform.setTopLeft(Point{2.0, platformStart.y});
+
+    level.reset();
+
+    EXPECT_EQ(level.bricks.data(), brickData);
+    EXPECT_EQ(level.bricks[0].hitpoints(), 1);
+    EXPECT_EQ(level.bricks[1].hitpoints(), 2);
+    EXPECT_EQ(level.aliveBrickCount(), 2);
+    EXPECT_EQ(level.brickGrid.query(Point{0.0, 0.0}, Point{9.0, 9.0}),
+              (std::vector<std::size_t>{0, 1}));
+    EXPECT_EQ(level.ball.topLeft().x, ballStart.x);
+    EXPECT_EQ(level.ball.topLeft().y, ballStart.y);
+    EXPECT_FALSE(level.ball.isActive());
+    EXPECT_EQ(level.platform.topLeft().x, platformStart.x);
+}
+
+TEST(LevelTest, binaryRoundTrip)
+{
+    std::istringstream ist{"W 10 H 20\n"
+                           "X 1.2 Y 3.4 W 5.6 H 7.8 HP 9\n"
+                           "X 0.1 Y 0.3 W 1.0 H 0.5 HP 2\n"
+                           "X 9.8 Y 7.6 W 5.4 H 3.2\n"};
+    Level text;
+    ist >> text;
+
+    std::ostringstream ost;
+    writeBinary(ost, text);
+    auto data = ost.str();
+    auto binary =
+        readFromBinary(reinterpret_cast<const unsigned char*>(data.data()),
+                       data.size());
+
+    EXPECT_EQ(binary.gridWidth(), text.gridWidth());
+    EXPECT_EQ(binary.gridHeight(), text.gridHeight());
+    ASSERT_EQ(binary.bricks.size(), text.bricks.size());
+    for (std::size_t i = 0; i < text.bricks.size(); ++i) {
+        EXPECT_EQ(binary.bricks[i].topLeft().x, text.bricks[i].topLeft().x);
+        EXPECT_EQ(binary.bricks[i].topLeft().y, text.bricks[i].topLeft().y);
+        EXPECT_EQ(binary.bricks[i].width(), text.bricks[i].width());
+        EXPECT_EQ(binary.bricks[i].height(), text.bricks[i].height());
+        EXPECT_EQ(binary.bricks[i].hitpoints(), text.bricks[i].hitpoints());
+    }
+    ASSERT_EQ(binary.indestructibleBricks.size(), 1);
+    EXPECT_EQ(binary.indestructibleBricks[0].topLeft().x,
+              text.indestructibleBricks[0].topLeft().x);
+    EXPECT_EQ(binary.indestructibleBricks[0].height(),
+              text.indestructibleBricks[0].height());
+    EXPECT_EQ(binary.aliveBrickCount(), 2);
+}
+
+TEST(LevelTest, readFromBinaryRejectsInvalidData)
+{
+    std::istringstream ist{"W 10 H 20\nX 1.0 Y 1.0 W 1.0 H 1.0 HP 1\n"};
+    Level level;
+    ist >> level;
+    std::ostringstream ost;
+    writeBinary(ost, level);
+    auto data = ost.str();
+
+    auto read = [](const std::string& bytes) {
+        return readFromBinary(
+            reinterpret_cast<const unsigned char*>(bytes.data()),
+            bytes.size());
+    };
+
+    EXPECT_THROW(read(""), std::runtime_error);
+    EXPECT_THROW(read(data.substr(0, data.size() - 1)), std::runtime_error);
+
+    auto wrongMagic = data;
+    wrongMagic[0] = 'X';
+    EXPECT_THROW(read(wrongMagic), std::runtime_error);
+
+    auto outsideOfGrid = data;
+    double x{11.0};
+    std::memcpy(&outsideOfGrid[sizeof(bricks::impl::BinaryLevelHeader)], &x,
+                sizeof(x));
+    EXPECT_THROW(read(outsideOfGrid), std::runtime_error);
+}
+
+TEST(LevelTest, readFromBinaryRejectsCorruptedRecord)
+{
+    std::istringstream ist{"W 10 H 20\nX 1.0 Y 1.0 W 1.0 H 1.0 HP 1\n"
+                           "X 3.0 Y 1.0 W 1.0 H 1.0\n"};
+    Level level;
+    ist >> level;
+    std::ostringstream ost;
+    writeBinary(ost, level);
+    auto data = ost.str();
+
+    auto readWith = [&data](std::size_t offset, double value) {
+        auto bytes = data;
+        std::memcpy(&bytes[offset], &value, sizeof(value));
+        return readFromBinary(
+            reinterpret_cast<const unsigned char*>(bytes.data()),
+            bytes.size());
+    };
+
+    using bricks::impl::BinaryBrickRecord;
+    using bricks::impl::BinaryIndestructibleBrickRecord;
+    auto brick = sizeof(bricks::impl::BinaryLevelHeader);
+    auto indestructibleBrick = brick + sizeof(BinaryBrickRecord);
+    auto nan = std::numeric_limits<double>::quiet_NaN();
+    auto inf = std::numeric_limits<double>::infinity();
+
+    for (auto record : {brick, indestructibleBrick}) {
+        auto x = record + offsetof(BinaryBrickRecord, x);
+        auto y = record + offsetof(BinaryBrickRecord, y);
+        EXPECT_THROW(readWith(x, -1.0), std::runtime_error);
+        EXPECT_THROW(readWith(y, -1.0), std::runtime_error);
+        EXPECT_THROW(readWith(y, 21.0), std::runtime_error);
+        EXPECT_THROW(readWith(x, nan), std::runtime_error);
+        EXPECT_THROW(readWith(y, inf), std::runtime_error);
+    }
+    EXPECT_THROW(readWith(brick + offsetof(BinaryBrickRecord, width), nan),
+                 std::runtime_error);
+    EXPECT_THROW(readWith(brick + offsetof(BinaryBrickRecord, height), inf),
+                 std::runtime_error);
+    EXPECT_THROW(
+        readWith(indestructibleBrick +
+                     offsetof(BinaryIndestructibleBrickRecord, width),
+                 nan),
+        std::runtime_error);
+    EXPECT_NO_THROW(readWith(brick + offsetof(BinaryBrickRecord, x), 2.0));
+}
+
+TEST(LevelTest, readLevelPicksFormatByExtension)
+{
+    test::TemporaryLevels levelFiles;
+    auto textFilename =
+        levelFiles.add("W 10 H 20\nX 1.0 Y 1.0 W 2.0 H 1.0 HP 3\n");
+    auto binaryFilename = levelFiles.add("", ".blvl");
+    {
+        std::ofstream ofs{binaryFilename, std::ios::binary};
+        writeBinary(ofs, readFromFile(textFilename));
+    }
+
+    auto text = readLevel(textFilename);
+    auto binary = readLevel(binaryFilename);
+
+    EXPECT_EQ(binary.gridWidth(), text.gridWidth());
+    ASSERT_EQ(binary.bricks.size(), 1);
+    EXPECT_EQ(binary.bricks[0].hitpoints(), 3);
+    EXPECT_EQ(binary.bricks[0].topLeft().x, text.bricks[0].topLeft().x);
+}
@@ -0,0 +1,75 @@
+#include "gtest/gtest.h"
+
+#include "../include/Palette.h"
+
+using namespace bricks;
+using namespace bricks::types;
+
+void expectSameColor(const RGBColor& a, const RGBColor& b)
+{
+    EXPECT_EQ(a.r(), b.r());
+    EXPECT_EQ(a.g(), b.g());
+    EXPECT_EQ(a.b(), b.b());
+    EXPECT_EQ(a.a(), b.a());
+}
+
+TEST(Palette, BrickShadesAreDerivedFromBase)
+{
+    Palette palette;
+
+    for (int hp = 1; hp <= Palette::maxBrickHitpoints; ++hp) {
+        const auto& shades = palette.brick(hp, false);
+        expectSameColor(shades.lighter, shades.base.lighter());
+        expectSameColor(shades.darker, shades.base.darker());
+    }
+}
+
+TEST(Palette, PausedBrickIsGrayscale)
+{
+    Palette palette;
+
+    for (int hp = 1; hp <= Palette::maxBrickHitpoints; ++hp) {
+        const auto& base = palette.brick(hp, false).base;
+        const auto& paused = palette.brick(hp, true);
+        expectSameColor(paused.base, base.grayscale());
+        expectSameColor(paused.lighter, base.grayscale().lighter());
+        expectSameColor(paused.darker, base.grayscale().darker());
+    }
+}
+
+TEST(Palette, BrickColors)
+{
+    Palette palette;
+
+    expectSameColor(palette.brick(1, false).base, RGBColor{0xFD, 0xEF, 0x42});
+    expectSameColor(palette.brick(9, false).base, RGBColor{0xF4, 0x46, 0x11});
+}
+
+TEST(Palette, ObjectColors)
+{
+    Palette palette;
+
+    expectSameColor(palette.object(PaletteObject::background, false).base,
+                RGBColor{0x1E, 0x1E, 0x1E});
+    expectSameColor(palette.object(PaletteObject::ball, false).base,
+                RGBColor{0xCC, 0xFF, 0xFF});
+    expectSameColor(palette.object(PaletteObject::platform, false).base,
+                RGBColor{0xBF, 0xBF, 0xBF});
+    expectSameColor(palette.object(PaletteObject::wall, false).base,
+                RGBColor{0xBF, 0x80, 0x40});
+    expectSameColor(palette.object(PaletteObject::indestructibleBrick, false).base,
+                RGBColor{0xFF, 0x00, 0x00});
+    expectSameColor(palette.object(PaletteObject::wall, true).base,
+                RGBColor{0xBF, 0x80, 0x40}.grayscale());
+}
+
+TEST(Palette, MakeShades)
+{
+    RGBColor color{0x10, 0x20, 0x30};
+
+    auto shades = makeShades(color);
+
+    expectSameColor(shades.base, color);
+    expectSameColor(shades.lighter, color.lighter());
+    expectSameColor(shades.darker, color.darker());
+}
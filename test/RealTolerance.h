@@ -0,0 +1,16 @@
+#ifndef TEST_REALTOLERANCE_H
+#define TEST_REALTOLERANCE_H
+
+#include "../include/types/Real.h"
+
+#include <limits>
+
+namespace bricks::test {
+
+// Tolerance for comparing values calculated in types::Real, like angles in
+// radians or ball positions of a few units, with their exact values.
+constexpr double realTolerance{64 *
+                               std::numeric_limits<types::Real>::epsilon()};
+
+} // namespace bricks::test
+#endif
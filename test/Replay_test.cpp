@@ -0,0 +1,151 @@
+#include "gtest/gtest.h"
+
+#include "../include/Headless.h"
+#include "../include/Replay.h"
+#include "../include/Simulation.h"
+
+#include "TestLevels.h"
+
+#include <sstream>
+#include <stdexcept>
+
+using namespace bricks;
+
+using Event = InputHandler::Event;
+
+class ReplayTest : public ::testing::Test {
+protected:
+    test::TemporaryLevels levelFiles{
+        "W 10 H 10\nX 4.0 Y 1.0 W 2.0 H 1.0 HP 1\n"};
+    std::string levelFilename = levelFiles.filenames().front();
+};
+
+TEST(Replay, writeAndReadRoundTrip)
+{
+    Replay replay;
+    replay.seed = 0x0123456789abcdefULL;
+    replay.platformDeviation = 0.25;
+    replay.difficultyParameters =
+        DifficultyParameters{types::Velocity{18.0}, types::Width{3.5},
+                             types::Velocity{20.0}, types::Gravity{2.0}};
+    replay.tickMS = 1000.0 / 60.0;
+    replay.events = {Event::space, Event::none,  Event::none, Event::left,
+                     Event::left,  Event::right, Event::p};
+    replay.events.insert(replay.events.end(), 1000, Event::none);
+
+    std::stringstream ss;
+    writeReplay(ss, replay);
+    auto read = readReplay(ss);
+
+    EXPECT_EQ(read.seed, replay.seed);
+    EXPECT_EQ(read.platformDeviation, 0.25);
+    EXPECT_EQ(read.difficultyParameters.getPlatformVelocity()(), 18.0);
+    EXPECT_EQ(read.difficultyParameters.getPlatformWidth()(), 3.5);
+    EXPECT_EQ(read.difficultyParameters.getBallVelocity()(),
+              replay.difficultyParameters.getBallVelocity()());
+    EXPECT_EQ(read.difficultyParameters.getBallGravity()(), 2.0);
+    EXPECT_EQ(read.tickMS, replay.tickMS);
+    EXPECT_EQ(read.events, replay.events);
+}
+
+TEST(Replay, runsOfEqualEventsAreCompact)
+{
+    Replay shortReplay;
+    shortReplay.events.assign(1, Event::none);
+    Replay longReplay;
+    longReplay.events.assign(100000, Event::none);
+
+    std::stringstream shortStream;
+    writeReplay(shortStream, shortReplay);
+    std::stringstream longStream;
+    writeReplay(longStream, longReplay);
+
+    EXPECT_LE(longStream.str().size(), shortStream.str().size() + 2);
+}
+
+TEST(Replay, readRejectsInvalidData)
+{
+    std::stringstream notAReplay{"XXXX"};
+    EXPECT_THROW(readReplay(notAReplay), std::runtime_error);
+
+    Replay replay;
+    replay.events.assign(10, Event::left);
+    std::stringstream ss;
+    writeReplay(ss, replay);
+    auto data = ss.str();
+
+    std::stringstream truncated{data.substr(0, data.size() - 1)};
+    EXPECT_THROW(readReplay(truncated), std::runtime_error);
+
+    data[data.size() - 2] = 42;
+    std::stringstream invalidEvent{data};
+    EXPECT_THROW(readReplay(invalidEvent), std::runtime_error);
+}
+
+TEST(Replay, varUInt)
+{
+    for (std::uint64_t value : {0ULL, 1ULL, 127ULL, 128ULL, 300ULL,
+                                0xffffffffffffffffULL}) {
+        std::stringstream ss;
+        bricks::impl::writeVarUInt(ss, value);
+        EXPECT_EQ(bricks::impl::readVarUInt(ss), value);
+    }
+}
+
+TEST_F(ReplayTest, replayReproducesRecordedGame)
+{
+    Replay replay;
+    replay.seed = 99;
+    replay.platformDeviation = 0.05;
+    replay.tickMS = 16.0;
+
+    Simulation recorded{{levelFilename}, 0, replay.difficultyParameters,
+                        replay.seed, replay.platformDeviation};
+    auto recordedResult = runHeadless(
+        recorded, makeRecordingInput(followBall, replay), 5000);
+    ASSERT_EQ(replay.events.size(), 5000);
+
+    std::stringstream ss;
+    writeReplay(ss, replay);
+    auto read = readReplay(ss);
+
+    Simulation replayed{{levelFilename}, 0, read.difficultyParameters,
+                        read.seed, read.platformDeviation};
+    auto replayedResult = runReplay(replayed, read);
+
+    EXPECT_EQ(replayedResult.ticks, recordedResult.ticks);
+    EXPECT_EQ(replayedResult.score, recordedResult.score);
+    EXPECT_EQ(replayed.level().ball.topLeft().x,
+              recorded.level().ball.topLeft().x);
+    EXPECT_EQ(replayed.level().ball.topLeft().y,
+              recorded.level().ball.topLeft().y);
+}
+
+TEST_F(ReplayTest, replayRestartsAfterGameOver)
+{
+    Replay replay;
+    replay.events.assign(200000, Event::space);
+
+    Simulation simulation{{levelFilename}};
+    int gameOvers{0};
+    auto result =
+        runReplay(simulation, replay, [&gameOvers](const Simulation& s) {
+            if (s.isGameOver()) {
+                ++gameOvers;
+            }
+        });
+
+    EXPECT_EQ(result.ticks, 200000);
+    EXPECT_GE(gameOvers, 1);
+}
+
+TEST_F(ReplayTest, replayStopsOnQuit)
+{
+    Replay replay;
+    replay.events = {Event::none, Event::escape, Event::none};
+
+    Simulation simulation{{levelFilename}};
+    auto result = runReplay(simulation, replay);
+
+    EXPECT_EQ(result.ticks, 2);
+}
@@ -0,0 +1,41 @@
+#include "gtest/gtest.h"
+
+#include "../include/ScreenRect.h"
+
+using namespace bricks;
+
+TEST(ScreenRect, Overlaps)
+{
+    EXPECT_TRUE(overlaps(ScreenRect{0, 0, 10, 10}, ScreenRect{9, 9, 2, 2}));
+    EXPECT_FALSE(overlaps(ScreenRect{0, 0, 10, 10}, ScreenRect{10, 0, 2, 2}));
+    EXPECT_FALSE(overlaps(ScreenRect{0, 0, 10, 10}, ScreenRect{0, 10, 2, 2}));
+}
+
+TEST(ScreenRect, Unite)
+{
+    EXPECT_EQ(unite(ScreenRect{0, 0, 2, 2}, ScreenRect{5, 6, 1, 1}),
+              (ScreenRect{0, 0, 6, 7}));
+}
+
+TEST(ScreenRect, ToScreenRect)
+{
+    EXPECT_EQ(toScreenRect(1.0, 2.0, 3.0, 0.5, 10.0, 20.0),
+              (ScreenRect{10, 40, 30, 10}));
+    EXPECT_EQ(toScreenRect(1.09, 0.0, 1.0, 1.0, 10.0, 10.0),
+              (ScreenRect{10, 0, 10, 10}));
+}
+
+TEST(ScreenRect, Bevel)
+{
+    ScreenRect rect{10, 20, 30, 40};
+
+    auto highlights = bevelHighlights(rect);
+    EXPECT_EQ(highlights[0], (ScreenRect{10, 20, 2, 41}));
+    EXPECT_EQ(highlights[1], (ScreenRect{10, 20, 31, 2}));
+
+    auto shadows = bevelShadows(rect);
+    EXPECT_EQ(shadows[0], (ScreenRect{10, 59, 31, 2}));
+    EXPECT_EQ(shadows[1], (ScreenRect{39, 20, 2, 41}));
+
+    EXPECT_EQ(withBevel(rect), (ScreenRect{10, 20, 31, 41}));
+}
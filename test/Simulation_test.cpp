@@ -0,0 +1,152 @@
+#include "gtest/gtest.h"
+
+#include "../include/Headless.h"
+#include "../include/Simulation.h"
+
+#include "TestLevels.h"
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+using namespace bricks;
+
+using Event = InputHandler::Event;
+
+class SimulationTest : public ::testing::Test {
+protected:
+    test::TemporaryLevels levelFiles{
+        "W 10 H 10\nX 4.0 Y 1.0 W 2.0 H 1.0 HP 1\n",
+        "W 10 H 10\nX 1.0 Y 1.0 W 2.0 H 1.0 HP 2\n"};
+    std::vector<std::string> levelFilenames = levelFiles.filenames();
+};
+
+TEST_F(SimulationTest, constructor)
+{
+    Simulation simulation{levelFilenames, 1234};
+
+    EXPECT_EQ(simulation.currentLevel(), 1);
+    EXPECT_EQ(simulation.lifes(), 5);
+    EXPECT_EQ(simulation.score(), 0);
+    EXPECT_EQ(simulation.highscore(), 1234);
+    EXPECT_EQ(simulation.level().bricks.size(), 1);
+    EXPECT_FALSE(simulation.isGameOver());
+    EXPECT_FALSE(simulation.level().ball.isActive());
+}
+
+TEST_F(SimulationTest, spaceActivatesBall)
+{
+    Simulation simulation{levelFilenames};
+
+    auto startPosition = simulation.level().ball.topLeft();
+    simulation.step(Event::space, 16.0);
+    EXPECT_TRUE(simulation.level().ball.isActive());
+
+    simulation.step(Event::none, 16.0);
+    EXPECT_NE(simulation.level().ball.topLeft().y, startPosition.y);
+}
+
+TEST_F(SimulationTest, pauseStopsBall)
+{
+    Simulation simulation{levelFilenames};
+
+    simulation.step(Event::space, 16.0);
+    simulation.step(Event::p, 16.0);
+    EXPECT_TRUE(simulation.isPaused());
+    EXPECT_TRUE(simulation.changedPauseState());
+
+    auto position = simulation.level().ball.topLeft();
+    simulation.step(Event::none, 16.0);
+    EXPECT_EQ(simulation.level().ball.topLeft().x, position.x);
+    EXPECT_EQ(simulation.level().ball.topLeft().y, position.y);
+}
+
+TEST_F(SimulationTest, quit)
+{
+    Simulation simulation{levelFilenames};
+
+    simulation.step(Event::escape, 16.0);
+    EXPECT_TRUE(simulation.isQuit());
+}
+
+TEST_F(SimulationTest, losingAllLifesEndsGame)
+{
+    Simulation simulation{levelFilenames};
+
+    int steps = 0;
+    while (!simulation.isGameOver() && steps < 100000) {
+        simulation.step(Event::space, 16.0);
+        ++steps;
+    }
+    EXPECT_TRUE(simulation.isGameOver());
+    EXPECT_EQ(simulation.lifes(), 0);
+    ASSERT_FALSE(simulation.sounds().empty());
+    EXPECT_EQ(simulation.sounds().back(), Sound::gameOver);
+
+    simulation.restart();
+    EXPECT_FALSE(simulation.isGameOver());
+    EXPECT_EQ(simulation.lifes(), 5);
+    EXPECT_EQ(simulation.currentLevel(), 1);
+    EXPECT_EQ(simulation.score(), 0);
+}
+
+TEST_F(SimulationTest, restartResetsLevel)
+{
+    Simulation simulation{levelFilenames};
+
+    int steps = 0;
+    while (!simulation.isGameOver() && steps < 100000) {
+        simulation.step(Event::space, 16.0);
+        ++steps;
+    }
+    ASSERT_TRUE(simulation.isGameOver());
+
+    simulation.restart();
+    EXPECT_EQ(simulation.currentLevel(), 1);
+    const auto& level = simulation.level();
+    EXPECT_EQ(level.aliveBrickCount(), static_cast<int>(level.bricks.size()));
+    for (const auto& brick : level.bricks) {
+        EXPECT_EQ(brick.hitpoints(), brick.startHitpoints());
+    }
+    EXPECT_FALSE(level.ball.isActive());
+}
+
+TEST_F(SimulationTest, reportsHitBricks)
+{
+    Simulation simulation{levelFilenames};
+    EXPECT_TRUE(simulation.hitBricks().empty());
+
+    int steps = 0;
+    while (simulation.score() == 0 && !simulation.isGameOver() &&
+           steps < 100000) {
+        simulation.step(followBall(simulation.level()), 16.0);
+        if (simulation.score() == 0) {
+            EXPECT_TRUE(simulation.hitBricks().empty());
+        }
+        ++steps;
+    }
+    ASSERT_GT(simulation.score(), 0);
+
+    EXPECT_EQ(simulation.hitBricks(), std::vector<std::size_t>{0});
+    simulation.step(followBall(simulation.level()), 16.0);
+    EXPECT_TRUE(simulation.hitBricks().empty());
+}
+
+TEST(GetLevelFilenamesFromFolder, prefersBinaryLevels)
+{
+    auto folder =
+        std::filesystem::temp_directory_path() /
+        ("bricks_test_levels_" + std::to_string(std::random_device{}()));
+    std::filesystem::create_directories(folder);
+    for (auto name : {"1.lvl", "1.blvl", "2.lvl", "3.blvl", "notes.txt"}) {
+        std::ofstream{folder / name};
+    }
+
+    auto names = getLevelFilenamesFromFolder(folder.string());
+    std::filesystem::remove_all(folder);
+
+    ASSERT_EQ(names.size(), 3);
+    EXPECT_EQ(std::filesystem::path{names[0]}.filename(), "1.blvl");
+    EXPECT_EQ(std::filesystem::path{names[1]}.filename(), "2.lvl");
+    EXPECT_EQ(std::filesystem::path{names[2]}.filename(), "3.blvl");
+}
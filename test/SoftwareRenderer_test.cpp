@@ -0,0 +1,100 @@
+#include "gtest/gtest.h"
+
+#include "../include/SoftwareRenderer.h"
+
+#include "../include/Level.h"
+#include "../include/Palette.h"
+
+#include "../include/types/GridHeight.h"
+#include "../include/types/GridWidth.h"
+
+using namespace bricks;
+using namespace bricks::types;
+
+using Brick = game_objects::Brick;
+using IndestructibleBrick = game_objects::IndestructibleBrick;
+
+class SoftwareRendererTest : public ::testing::Test {
+protected:
+    // 10 pixels per grid unit
+    SoftwareRendererTest()
+        : level{DifficultyParameters{},
+                GridWidth{10},
+                GridHeight{10},
+                {Brick{Point{4.0, 2.0}, Width{2.0}, Height{1.0},
+                       Hitpoints{3}}},
+                {}},
+          renderer{static_cast<std::size_t>(level.gridWidth()) * 10,
+                   static_cast<std::size_t>(level.gridHeight()) * 10,
+                   static_cast<std::size_t>(level.gridWidth()),
+                   static_cast<std::size_t>(level.gridHeight())}
+    {
+    }
+
+    std::uint32_t brickPixel(int hitpoints) const
+    {
+        return toPixel(palette.brick(hitpoints, false).base);
+    }
+
+    Level level;
+    SoftwareRenderer renderer;
+    Palette palette;
+};
+
+TEST_F(SoftwareRendererTest, DrawsBackgroundWallsAndBricks)
+{
+    renderer.render(level);
+    const auto& frame = renderer.frame();
+
+    auto brickTopLeft = level.bricks.front().topLeft();
+    auto brickX = static_cast<int>(brickTopLeft.x * 10.0);
+    auto brickY = static_cast<int>(brickTopLeft.y * 10.0);
+
+    // Inside the brick, away from the bevel
+    EXPECT_EQ(frame.pixel(brickX + 10, brickY + 5), brickPixel(3));
+    EXPECT_EQ(frame.pixel(brickX, brickY),
+              toPixel(palette.brick(3, false).lighter));
+    EXPECT_EQ(frame.pixel(brickX + 19, brickY + 5),
+              toPixel(palette.brick(3, false).darker));
+
+    EXPECT_EQ(frame.pixel(5, 60),
+              toPixel(palette.object(PaletteObject::wall, false).base));
+    EXPECT_EQ(frame.pixel(60, 60),
+              toPixel(palette.object(PaletteObject::background, false).base));
+}
+
+TEST_F(SoftwareRendererTest, DestroyedBrickIsNotDrawn)
+{
+    auto brick = level.bricks.front();
+    while (!brick.isDestroyed()) {
+        brick.decreaseHitpoints();
+    }
+    level.brickGrid.update(0, brick);
+    renderer.render(level);
+
+    auto brickTopLeft = level.bricks.front().topLeft();
+    EXPECT_EQ(renderer.frame().pixel(static_cast<int>(brickTopLeft.x * 10.0) +
+                                         10,
+                                     static_cast<int>(brickTopLeft.y * 10.0) +
+                                         5),
+              toPixel(palette.object(PaletteObject::background, false).base));
+}
+
+TEST_F(SoftwareRendererTest, PausedIsGrayscale)
+{
+    renderer.setPaused(true);
+    renderer.render(level);
+
+    EXPECT_EQ(renderer.frame().pixel(60, 60),
+              toPixel(palette.object(PaletteObject::background, true).base));
+}
+
+TEST_F(SoftwareRendererTest, DrawsBallAtPassedPosition)
+{
+    renderer.render(level, Point{6.0, 6.0}, level.platform.topLeft());
+
+    auto x = static_cast<int>((6.0 + level.ball.width() / 2.0) * 10.0);
+    auto y = static_cast<int>((6.0 + level.ball.height() / 2.0) * 10.0);
+    EXPECT_EQ(renderer.frame().pixel(x, y),
+              toPixel(palette.object(PaletteObject::ball, false).base));
+}
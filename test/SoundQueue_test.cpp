@@ -0,0 +1,82 @@
+#include "gtest/gtest.h"
+
+#include "../include/SoundQueue.h"
+
+#include <thread>
+#include <vector>
+
+using namespace bricks;
+
+TEST(SoundQueue, PopFromEmptyQueue)
+{
+    SoundQueue queue;
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop().has_value());
+}
+
+TEST(SoundQueue, PopsInPushOrder)
+{
+    SoundQueue queue;
+
+    EXPECT_TRUE(queue.push(Sound::hitBrick));
+    EXPECT_TRUE(queue.push(Sound::destroyBrick));
+    EXPECT_FALSE(queue.empty());
+
+    EXPECT_EQ(queue.pop(), Sound::hitBrick);
+    EXPECT_EQ(queue.pop(), Sound::destroyBrick);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(SoundQueue, PushFailsIfFull)
+{
+    SoundQueue queue;
+
+    for (std::size_t i = 0; i < SoundQueue::capacity; ++i) {
+        EXPECT_TRUE(queue.push(Sound::hitPlatform));
+    }
+    EXPECT_FALSE(queue.push(Sound::gameOver));
+
+    EXPECT_EQ(queue.pop(), Sound::hitPlatform);
+    EXPECT_TRUE(queue.push(Sound::gameOver));
+}
+
+TEST(SoundQueue, WrapsAround)
+{
+    SoundQueue queue;
+
+    for (std::size_t i = 0; i < 3 * SoundQueue::capacity; ++i) {
+        auto sound = static_cast<Sound>(i % soundCount);
+        EXPECT_TRUE(queue.push(sound));
+        EXPECT_EQ(queue.pop(), sound);
+    }
+}
+
+TEST(SoundQueue, TransfersBetweenTwoThreads)
+{
+    SoundQueue queue;
+    constexpr std::size_t count{10000};
+
+    std::thread producer{[&queue]() {
+        for (std::size_t i = 0; i < count; ++i) {
+            while (!queue.push(static_cast<Sound>(i % soundCount))) {
+                std::this_thread::yield();
+            }
+        }
+    }};
+
+    std::vector<Sound> received;
+    while (received.size() < count) {
+        if (auto sound = queue.pop()) {
+            received.push_back(*sound);
+        }
+        else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    for (std::size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(received[i], static_cast<Sound>(i % soundCount));
+    }
+}
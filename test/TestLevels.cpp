@@ -0,0 +1,67 @@
+#include "TestLevels.h"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+
+namespace bricks::test {
+
+namespace {
+
+std::string uniqueFilename(const std::string& extension)
+{
+    // Tells apart the runs, the counter the files of one run
+    static const auto run = std::random_device{}();
+    static std::atomic<unsigned> counter{0};
+
+    auto folder = std::filesystem::temp_directory_path();
+    for (;;) {
+        auto name = "bricks_test_" + std::to_string(run) + "_" +
+                    std::to_string(counter++) + extension;
+        auto path = folder / name;
+        if (!std::filesystem::exists(path)) {
+            return path.string();
+        }
+    }
+}
+
+} // namespace
+
+TemporaryLevels::TemporaryLevels(std::initializer_list<std::string> contents)
+{
+    for (const auto& content : contents) {
+        add(content);
+    }
+}
+
+TemporaryLevels::~TemporaryLevels()
+{
+    // Tests may have removed a file already
+    std::error_code error;
+    for (const auto& filename : mFilenames) {
+        std::filesystem::remove(filename, error);
+    }
+}
+
+std::string TemporaryLevels::add(const std::string& content,
+                                 const std::string& extension)
+{
+    auto filename = uniqueFilename(extension);
+    std::ofstream ofs{filename, std::ios::binary};
+    if (!ofs) {
+        throw std::runtime_error("File:" + filename + " could not be opened\n");
+    }
+    ofs << content;
+    mFilenames.push_back(filename);
+    return filename;
+}
+
+const std::vector<std::string>& TemporaryLevels::filenames() const
+{
+    return mFilenames;
+}
+
+} // namespace bricks::test
@@ -0,0 +1,37 @@
+#ifndef TEST_TESTLEVELS_H
+#define TEST_TESTLEVELS_H
+
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+namespace bricks::test {
+
+// Level files in the temp directory for as long as the object lives.
+// Every file gets a unique name, so test runs in parallel do not overwrite
+// each others levels.
+class TemporaryLevels {
+public:
+    TemporaryLevels() = default;
+    // Writes one .lvl file per content.
+    TemporaryLevels(std::initializer_list<std::string> contents);
+    ~TemporaryLevels();
+
+    TemporaryLevels(const TemporaryLevels&) = delete;
+    TemporaryLevels(TemporaryLevels&&) = delete;
+    TemporaryLevels& operator=(const TemporaryLevels&) = delete;
+    TemporaryLevels& operator=(TemporaryLevels&&) = delete;
+
+    // Returns the filename of the new file.
+    std::string add(const std::string& content,
+                    const std::string& extension = ".lvl");
+
+    // In the order they were added.
+    const std::vector<std::string>& filenames() const;
+
+private:
+    std::vector<std::string> mFilenames;
+};
+
+} // namespace bricks::test
+#endif
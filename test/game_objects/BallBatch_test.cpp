@@ -0,0 +1,167 @@
+#include "gtest/gtest.h"
+
+#include "../../include/game_objects/Ball.h"
+#include "../../include/game_objects/BallBatch.h"
+#include "../../include/types/Real.h"
+#include "../../include/utility/OperatorDegree.h"
+
+#include <type_traits>
+
+using namespace bricks;
+using namespace bricks::game_objects;
+using namespace bricks::types;
+using namespace bricks::utility;
+
+namespace {
+
+std::vector<Ball> makeBalls(std::size_t count)
+{
+    std::vector<Ball> balls;
+    for (std::size_t i = 0; i < count; ++i) {
+        auto offset = static_cast<double>(i);
+        auto angleOffset = static_cast<Real>(i);
+        balls.emplace_back(Point{10.0 + offset, 20.0 - offset / 2.0},
+                           Width{1.0}, Height{1.0}, Velocity{2.0 + offset},
+                           Angle{15.0_deg + 37.0_deg * angleOffset},
+                           Gravity{static_cast<double>(i % 3)});
+        balls.back().activate();
+    }
+    return balls;
+}
+
+} // namespace
+
+template <typename Real>
+class BallBatchTest : public ::testing::Test {
+};
+
+using Reals = ::testing::Types<float, double>;
+TYPED_TEST_SUITE(BallBatchTest, Reals);
+
+TYPED_TEST(BallBatchTest, add)
+{
+    BallBatch<TypeParam> batch;
+    auto balls = makeBalls(2);
+
+    EXPECT_EQ(batch.add(balls[0]), 0u);
+    EXPECT_EQ(batch.add(balls[1]), 1u);
+
+    EXPECT_EQ(batch.size(), 2u);
+    EXPECT_NEAR(batch.topLeft(1).x, balls[1].topLeft().x, 1e-5);
+    EXPECT_NEAR(batch.topLeft(1).y, balls[1].topLeft().y, 1e-5);
+    EXPECT_NEAR(batch.angle()[1], balls[1].angle().get(), 1e-5);
+    EXPECT_NEAR(batch.velocity()[1], balls[1].velocity(), 1e-5);
+    EXPECT_NEAR(batch.gravity()[1], balls[1].gravity(), 1e-5);
+    EXPECT_TRUE(batch.isActive(1));
+}
+
+TYPED_TEST(BallBatchTest, moveLikeBall)
+{
+    // Odd count, so the balls after the full SIMD registers are moved too
+    auto balls = makeBalls(19);
+    BallBatch<TypeParam> batch;
+    for (const auto& ball : balls) {
+        batch.add(ball);
+    }
+
+    for (int tick = 0; tick < 10; ++tick) {
+        batch.move(16.0);
+        for (auto& ball : balls) {
+            ball.move(16.0);
+        }
+    }
+
+    for (std::size_t i = 0; i < balls.size(); ++i) {
+        EXPECT_NEAR(batch.topLeft(i).x, balls[i].topLeft().x, 1e-3);
+        EXPECT_NEAR(batch.topLeft(i).y, balls[i].topLeft().y, 1e-3);
+    }
+}
+
+TEST(BallBatchDoubleTest, moveSameAsBall)
+{
+    if (!std::is_same_v<types::Real, double>) {
+        GTEST_SKIP() << "calcDelta calculates in float with BRICKS_FLOAT";
+    }
+
+    auto balls = makeBalls(19);
+    BallBatch<double> batch;
+    for (const auto& ball : balls) {
+        batch.add(ball);
+    }
+
+    for (int tick = 0; tick < 10; ++tick) {
+        batch.move(16.0);
+        for (auto& ball : balls) {
+            ball.move(16.0);
+        }
+    }
+
+    for (std::size_t i = 0; i < balls.size(); ++i) {
+        EXPECT_EQ(batch.topLeft(i).x, balls[i].topLeft().x);
+        EXPECT_EQ(batch.topLeft(i).y, balls[i].topLeft().y);
+    }
+}
+
+TYPED_TEST(BallBatchTest, setTakesOverChangedAngle)
+{
+    auto balls = makeBalls(2);
+    BallBatch<TypeParam> batch;
+    batch.add(balls[0]);
+    batch.add(balls[1]);
+    balls[0].setAngle(Angle{180.0_deg});
+    balls[0].setGravity(0.0);
+
+    batch.set(0, balls[0]);
+    batch.move(1000.0, 0, 1);
+
+    EXPECT_NEAR(batch.topLeft(0).x,
+                balls[0].topLeft().x - balls[0].velocity(), 1e-4);
+    EXPECT_NEAR(batch.topLeft(0).y, balls[0].topLeft().y, 1e-4);
+    EXPECT_EQ(batch.topLeft(1).x, static_cast<TypeParam>(balls[1].topLeft().x));
+}
+
+TYPED_TEST(BallBatchTest, inactiveBallDoesNotMove)
+{
+    Ball ball{Point{5.0, 5.0}, Width{1.0}, Height{1.0}, Velocity{10.0},
+              Angle{45.0_deg}, Gravity{1.0}};
+    BallBatch<TypeParam> batch;
+    batch.add(ball);
+
+    batch.move(100.0);
+    EXPECT_FALSE(batch.isActive(0));
+    EXPECT_EQ(batch.topLeft(0).x, 5.0);
+    EXPECT_EQ(batch.topLeft(0).y, 5.0);
+
+    batch.activate(0);
+    batch.move(100.0);
+    EXPECT_GT(batch.topLeft(0).x, 5.0);
+    EXPECT_GT(batch.topLeft(0).y, 5.0);
+}
+
+TYPED_TEST(BallBatchTest, setAngleChangesDirection)
+{
+    auto balls = makeBalls(1);
+    BallBatch<TypeParam> batch;
+    batch.add(balls[0]);
+    batch.setGravity(0, 0);
+    batch.setVelocity(0, 10);
+    batch.setAngle(0, static_cast<TypeParam>(180.0_deg));
+
+    batch.move(1000.0);
+
+    EXPECT_NEAR(batch.topLeft(0).x, balls[0].topLeft().x - 10.0, 1e-4);
+    EXPECT_NEAR(batch.topLeft(0).y, balls[0].topLeft().y, 1e-4);
+}
+
+TYPED_TEST(BallBatchTest, copyTopLeftTo)
+{
+    auto balls = makeBalls(1);
+    BallBatch<TypeParam> batch;
+    batch.add(balls[0]);
+    batch.setTopLeft(0, Point{3.0, 4.0});
+
+    batch.copyTopLeftTo(0, balls[0]);
+
+    EXPECT_EQ(balls[0].topLeft().x, 3.0);
+    EXPECT_EQ(balls[0].topLeft().y, 4.0);
+}
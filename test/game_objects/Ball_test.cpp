@@ -3,6 +3,8 @@
 #include "../../include/game_objects/Ball.h"
 #include "../../include/utility/OperatorDegree.h"
 
+#include "../RealTolerance.h"
+
 using namespace bricks;
 using namespace bricks::game_objects;
 using namespace bricks::game_objects::impl;
@@ -63,7 +65,7 @@ TEST_F(BallTest, gravity)
 
 class BallMoveMultipleParametersTests
     : public ::testing::TestWithParam<
-          std::tuple<bool, double, double, double, Point>> {
+          std::tuple<bool, double, Real, double, Point>> {
 protected:
 };
 
@@ -83,8 +85,8 @@ TEST_P(BallMoveMultipleParametersTests, CheckIfMovesCorrectly)
     auto timeInMS = 1000;
     obj.move(timeInMS);
 
-    EXPECT_NEAR(obj.topLeft().x, endPoint.x, 0.000000001);
-    EXPECT_NEAR(obj.topLeft().y, endPoint.y, 0.000000001);
+    EXPECT_NEAR(obj.topLeft().x, endPoint.x, test::realTolerance);
+    EXPECT_NEAR(obj.topLeft().y, endPoint.y, test::realTolerance);
 }
 
 INSTANTIATE_TEST_CASE_P(
@@ -97,32 +99,32 @@ INSTANTIATE_TEST_CASE_P(
         // 0 degrees
         std::make_tuple(true, 2.0, 0.0_deg, 0.0, Point{2.0, 0.0}),
         // 30 degrees
-        std::make_tuple(true, 2.0, 30.0_deg, 0.0, Point{1.732050807568877, 1}),
+        std::make_tuple(true, 2.0, 30.0_deg, 0.0, Point{1.7320508075688772, 1}),
         // 45 degrees
         std::make_tuple(true, 2.0, 45.0_deg, 0.0,
-                        Point{1.414213562373096, 1.414213562373096}),
+                        Point{1.4142135623730951, 1.4142135623730951}),
         // 60 degrees
         std::make_tuple(true, 2.0, 60.0_deg, 0.0,
-                        Point{1.0, 1.732050807568877}),
+                        Point{1.0, 1.7320508075688772}),
         // 90 degrees
         std::make_tuple(true, 2.0, 90.0_deg, 0.0, Point{0.0, 2.0}),
         // 90 degrees + gravity
         std::make_tuple(true, 2.0, 90.0_deg, 2.0, Point{0.0, 4.0}),
         // 120 degrees
         std::make_tuple(true, 2.0, 120.0_deg, 0.0,
-                        Point{-1, 1.732050807568877}),
+                        Point{-1, 1.7320508075688772}),
         // 135 degrees
         std::make_tuple(true, 2.0, 135.0_deg, 0.0,
-                        Point{-1.41421356237, 1.414213562373096}),
+                        Point{-1.4142135623730951, 1.4142135623730951}),
         // 180 degrees
         std::make_tuple(true, 2.0, 180.0_deg, 0.0, Point{-2.0, 0.0}),
         // 230 degrees
         std::make_tuple(true, 2.0, 230.0_deg, 0.0,
-                        Point{-1.28557521937, -1.53208888624}),
+                        Point{-1.285575219373079, -1.5320888862379558}),
         // 270 degrees
         std::make_tuple(true, 2.0, 270.0_deg, 0.0, Point{0.0, -2.0}),
         // 270 degrees + gravity
         std::make_tuple(true, 2.0, 270.0_deg, 2.0, Point{0.0, 0.0}),
         // 315 degress
         std::make_tuple(true, 2.0, 315.0_deg, 0.0,
-                        Point{1.414213562373096, -1.414213562373096})));
\ No newline at end of file
+                        Point{1.4142135623730951, -1.4142135623730951})));
\ No newline at end of file
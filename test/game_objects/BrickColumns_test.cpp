@@ -0,0 +1,102 @@
+#include "gtest/gtest.h"
+
+#include "../../include/game_objects/Brick.h"
+#include "../../include/game_objects/BrickColumns.h"
+
+using namespace bricks;
+using namespace bricks::game_objects;
+using namespace bricks::types;
+
+class BrickColumnsTest : public ::testing::Test {
+protected:
+    std::vector<Brick> bricks{
+        Brick{Point{1.0, 1.0}, Width{3.0}, Height{1.0}, Hitpoints{1}},
+        Brick{Point{4.0, 1.0}, Width{3.0}, Height{1.0}, Hitpoints{2}},
+        Brick{Point{1.5, 6.5}, Width{0.5}, Height{0.5}, Hitpoints{3}},
+    };
+};
+
+TEST(BrickColumnsTest_, defaultConstructor)
+{
+    BrickColumns columns;
+    std::vector<std::size_t> indices{7};
+
+    columns.sweep(Point{0.0, 0.0}, Point{5.0, 5.0}, indices);
+
+    EXPECT_EQ(columns.size(), 0);
+    EXPECT_TRUE(indices.empty());
+}
+
+TEST_F(BrickColumnsTest, constructorCopiesBricks)
+{
+    BrickColumns columns{bricks};
+
+    ASSERT_EQ(columns.size(), 3);
+    EXPECT_EQ(columns.x(), (std::vector<double>{1.0, 4.0, 1.5}));
+    EXPECT_EQ(columns.y(), (std::vector<double>{1.0, 1.0, 6.5}));
+    EXPECT_EQ(columns.width(), (std::vector<double>{3.0, 3.0, 0.5}));
+    EXPECT_EQ(columns.height(), (std::vector<double>{1.0, 1.0, 0.5}));
+    EXPECT_EQ(columns.hitpoints(), (std::vector<int>{1, 2, 3}));
+}
+
+TEST_F(BrickColumnsTest, sweepReturnsOverlappingBricks)
+{
+    BrickColumns columns{bricks};
+    std::vector<std::size_t> indices;
+
+    columns.sweep(Point{2.0, 0.5}, Point{2.5, 1.5}, indices);
+    EXPECT_EQ(indices, std::vector<std::size_t>{0});
+
+    columns.sweep(Point{3.5, 0.5}, Point{4.5, 1.5}, indices);
+    EXPECT_EQ(indices, (std::vector<std::size_t>{0, 1}));
+
+    columns.sweep(Point{2.0, 7.0}, Point{3.0, 8.0}, indices);
+    EXPECT_EQ(indices, std::vector<std::size_t>{2});
+
+    columns.sweep(Point{8.0, 8.0}, Point{9.0, 9.0}, indices);
+    EXPECT_TRUE(indices.empty());
+}
+
+TEST_F(BrickColumnsTest, sweepSkipsDestroyedBricks)
+{
+    BrickColumns columns{bricks};
+    std::vector<std::size_t> indices;
+
+    columns.setHitpoints(0, 0);
+    columns.sweep(Point{0.0, 0.0}, Point{9.0, 9.0}, indices);
+
+    EXPECT_EQ(indices, (std::vector<std::size_t>{1, 2}));
+    EXPECT_EQ(columns.hitpoints()[0], 0);
+}
+
+TEST(BrickColumnsTest_, sweepMatchesScalarSweep)
+{
+    std::vector<Brick> field;
+    for (int y = 1; y < 30; ++y) {
+        for (int x = 1; x < 40; x += 3) {
+            field.emplace_back(
+                Point{static_cast<double>(x), static_cast<double>(y)},
+                Width{3.0}, Height{1.0}, Hitpoints{1 + (x + y) % 9});
+        }
+    }
+    BrickColumns columns{field};
+    for (std::size_t i = 0; i < columns.size(); i += 7) {
+        columns.setHitpoints(i, 0);
+    }
+
+    std::vector<std::size_t> indices;
+    std::vector<std::size_t> expectedIndices;
+    for (double x = 0.0; x < 42.0; x += 1.3) {
+        for (double y = 0.0; y < 32.0; y += 1.7) {
+            Point topLeft{x, y};
+            Point bottomRight{x + 2.25, y + 0.75};
+
+            columns.sweep(topLeft, bottomRight, indices);
+            expectedIndices.clear();
+            impl::sweepScalar(columns, topLeft, bottomRight, 0,
+                              expectedIndices);
+
+            EXPECT_EQ(indices, expectedIndices);
+        }
+    }
+}
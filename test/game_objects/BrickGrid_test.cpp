@@ -0,0 +1,174 @@
+#include "gtest/gtest.h"
+
+#include "../../include/game_objects/Ball.h"
+#include "../../include/game_objects/Brick.h"
+#include "../../include/game_objects/BrickGrid.h"
+#include "../../include/game_objects/IndestructibleBrick.h"
+#include "../../include/game_objects/Physics.h"
+#include "../../include/game_objects/Wall.h"
+
+#include "../../include/utility/OperatorDegree.h"
+
+using namespace bricks;
+using namespace bricks::game_objects;
+using namespace bricks::types;
+using namespace bricks::utility;
+
+class BrickGridTest : public ::testing::Test {
+protected:
+    std::vector<Brick> bricks{
+        Brick{Point{1.0, 1.0}, Width{3.0}, Height{1.0}, Hitpoints{1}},
+        Brick{Point{4.0, 1.0}, Width{3.0}, Height{1.0}, Hitpoints{2}},
+        Brick{Point{1.5, 6.5}, Width{0.5}, Height{0.5}, Hitpoints{1}},
+    };
+};
+
+TEST(BrickGridTest_, defaultConstructor)
+{
+    BrickGrid grid;
+
+    EXPECT_EQ(grid.width(), 0);
+    EXPECT_EQ(grid.height(), 0);
+    EXPECT_TRUE(grid.query(Point{0.0, 0.0}, Point{5.0, 5.0}).empty());
+}
+
+TEST_F(BrickGridTest, queryReturnsBricksInArea)
+{
+    BrickGrid grid{10, 10, bricks};
+
+    EXPECT_EQ(grid.query(Point{2.0, 0.5}, Point{2.5, 1.5}),
+              std::vector<std::size_t>{0});
+    EXPECT_EQ(grid.query(Point{3.5, 0.5}, Point{4.5, 1.5}),
+              (std::vector<std::size_t>{0, 1}));
+    EXPECT_EQ(grid.query(Point{1.0, 6.0}, Point{1.2, 6.2}),
+              std::vector<std::size_t>{2});
+    EXPECT_TRUE(grid.query(Point{8.0, 8.0}, Point{9.0, 9.0}).empty());
+}
+
+TEST_F(BrickGridTest, queryClampsToGrid)
+{
+    BrickGrid grid{10, 10, bricks};
+
+    EXPECT_EQ(grid.query(Point{-5.0, -5.0}, Point{20.0, 20.0}),
+              (std::vector<std::size_t>{0, 1, 2}));
+}
+
+TEST_F(BrickGridTest, removedBrickIsNotReturned)
+{
+    BrickGrid grid{10, 10, bricks};
+
+    grid.remove(0, bricks[0]);
+
+    EXPECT_EQ(grid.query(Point{0.0, 0.0}, Point{9.0, 9.0}),
+              (std::vector<std::size_t>{1, 2}));
+}
+
+TEST_F(BrickGridTest, destroyedBrickIsNotAdded)
+{
+    bricks[2].decreaseHitpoints();
+    BrickGrid grid{10, 10, bricks};
+
+    EXPECT_TRUE(grid.query(Point{1.0, 6.0}, Point{2.0, 7.0}).empty());
+}
+
+TEST_F(BrickGridTest, resetAddsRestoredBricks)
+{
+    BrickGrid grid{10, 10, bricks};
+    bricks[0].decreaseHitpoints();
+    grid.update(0, bricks[0]);
+    bricks[1].decreaseHitpoints();
+    grid.update(1, bricks[1]);
+
+    bricks[0].resetHitpoints();
+    bricks[1].resetHitpoints();
+    grid.reset(bricks);
+
+    EXPECT_EQ(grid.query(Point{3.5, 0.5}, Point{4.5, 1.5}),
+              (std::vector<std::size_t>{0, 1}));
+    EXPECT_EQ(grid.columns().hitpoints(), (std::vector<int>{1, 2, 1}));
+}
+
+TEST_F(BrickGridTest, resetAddsBricksDestroyedWhenBuilt)
+{
+    bricks[2].decreaseHitpoints();
+    BrickGrid grid{10, 10, bricks};
+
+    bricks[2].resetHitpoints();
+    grid.reset(bricks);
+
+    EXPECT_EQ(grid.query(Point{1.0, 6.0}, Point{2.0, 7.0}),
+              std::vector<std::size_t>{2});
+}
+
+TEST_F(BrickGridTest, updateTakesOverHitpoints)
+{
+    BrickGrid grid{10, 10, bricks};
+
+    bricks[1].decreaseHitpoints();
+    grid.update(1, bricks[1]);
+    EXPECT_EQ(grid.columns().hitpoints()[1], 1);
+
+    bricks[1].decreaseHitpoints();
+    grid.update(1, bricks[1]);
+    EXPECT_EQ(grid.columns().hitpoints()[1], 0);
+    EXPECT_EQ(grid.query(Point{0.0, 0.0}, Point{9.0, 9.0}),
+              (std::vector<std::size_t>{0, 2}));
+    EXPECT_TRUE(grid.query(Point{5.0, 1.0}, Point{5.5, 1.5}).empty());
+}
+
+TEST_F(BrickGridTest, reflectFromGameObjectsRemovesDestroyedBricks)
+{
+    BrickGrid grid{10, 10, bricks};
+
+    Ball ball{Point{3.5, 1.5}, Width{1.0},      Height{1.0},
+              Velocity{1.0},   Angle{60.0_deg}, Gravity{0.0}};
+
+    std::vector<Hit> hitObjects;
+    reflectFromGameObjects(ball, std::vector<Wall>{},
+                           std::vector<IndestructibleBrick>{}, bricks, grid,
+                           hitObjects);
+
+    EXPECT_EQ(hitObjects.size(), 2);
+    EXPECT_TRUE(bricks[0].isDestroyed());
+    EXPECT_EQ(bricks[1].hitpoints(), 1);
+    EXPECT_EQ(grid.query(Point{0.0, 0.0}, Point{9.0, 9.0}),
+              (std::vector<std::size_t>{1, 2}));
+}
+
+TEST(BrickGridTest_, reflectFromGameObjectsMatchesFullScan)
+{
+    std::vector<Brick> field;
+    for (int y = 1; y < 8; ++y) {
+        for (int x = 1; x < 14; x += 3) {
+            field.emplace_back(Point{static_cast<double>(x),
+                                     static_cast<double>(y)},
+                               Width{3.0}, Height{1.0}, Hitpoints{2});
+        }
+    }
+
+    for (double x = 0.0; x < 15.0; x += 0.37) {
+        for (double y = 0.0; y < 9.0; y += 0.41) {
+            auto bricksFullScan = field;
+            auto bricksGrid = field;
+            BrickGrid grid{16, 10, bricksGrid};
+
+            Ball ballFullScan{Point{x, y},   Width{0.75},     Height{0.75},
+                              Velocity{1.0}, Angle{45.0_deg}, Gravity{0.0}};
+            auto ballGrid = ballFullScan;
+
+            std::vector<Hit> hitsFullScan;
+            reflectFromGameObjects(ballFullScan, std::vector<Wall>{},
+                                   std::vector<IndestructibleBrick>{},
+                                   bricksFullScan, hitsFullScan);
+            std::vector<Hit> hitsGrid;
+            reflectFromGameObjects(ballGrid, std::vector<Wall>{},
+                                   std::vector<IndestructibleBrick>{},
+                                   bricksGrid, grid, hitsGrid);
+
+            ASSERT_EQ(hitsFullScan.size(), hitsGrid.size());
+            EXPECT_EQ(ballFullScan.topLeft().x, ballGrid.topLeft().x);
+            EXPECT_EQ(ballFullScan.topLeft().y, ballGrid.topLeft().y);
+            EXPECT_EQ(ballFullScan.angle().get(), ballGrid.angle().get());
+        }
+    }
+}
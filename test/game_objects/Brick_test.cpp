@@ -61,4 +61,17 @@ TEST(BrickTest, isDestroyed)
     obj.decreaseHitpoints();
 
     EXPECT_TRUE(obj.isDestroyed());
-}
\ No newline at end of file
+}
+
+TEST(BrickTest, resetHitpoints)
+{
+    Brick obj{Point{0, 0}, Width{1}, Height{1}, Hitpoints{2}};
+    obj.decreaseHitpoints();
+    obj.decreaseHitpoints();
+    EXPECT_TRUE(obj.isDestroyed());
+
+    obj.resetHitpoints();
+
+    EXPECT_EQ(obj.hitpoints(), 2);
+    EXPECT_FALSE(obj.isDestroyed());
+}
@@ -2,11 +2,14 @@
 
 #include "../../include/game_objects/Ball.h"
 #include "../../include/game_objects/Brick.h"
+#include "../../include/game_objects/BrickGrid.h"
 #include "../../include/game_objects/IndestructibleBrick.h"
 #include "../../include/game_objects/Physics.h"
+#include "../../include/game_objects/Platform.h"
 #include "../../include/game_objects/Wall.h"
 
 #include "../../include/utility/OperatorDegree.h"
+#include "../../include/utility/Random.h"
 
 using namespace bricks;
 using namespace bricks::game_objects;
@@ -15,7 +18,7 @@ using namespace bricks::utility;
 
 class ReflectHorizontalParametersTests
     : public ::testing::TestWithParam<
-          std::tuple<Point, double, Point, double, int>> {
+          std::tuple<Point, Real, Point, Real, int>> {
 protected:
 };
 
@@ -36,9 +39,10 @@ TEST_P(ReflectHorizontalParametersTests, CheckResults)
         Brick{Point{3.0, 9.0}, Width{4.0}, Height{4.0}, Hitpoints{1}},
     };
 
-    std::vector<std::shared_ptr<GameObject>> hitObjects =
-        reflectFromGameObjects(ball, std::vector<Wall>{},
-                               std::vector<IndestructibleBrick>{}, bricks);
+    std::vector<Hit> hitObjects;
+    reflectFromGameObjects(ball, std::vector<Wall>{},
+                           std::vector<IndestructibleBrick>{}, bricks,
+                           hitObjects);
 
     EXPECT_EQ(hitObjects.size(), hitObjectsCount);
     EXPECT_EQ(ball.topLeft().x, ballResultTopLeft.x);
@@ -91,7 +95,7 @@ INSTANTIATE_TEST_SUITE_P(
 
 class ReflectVerticalParametersTests
     : public ::testing::TestWithParam<
-          std::tuple<Point, double, Point, double, int>> {
+          std::tuple<Point, Real, Point, Real, int>> {
 protected:
 };
 
@@ -112,9 +116,10 @@ TEST_P(ReflectVerticalParametersTests, CheckResults)
         Brick{Point{9.0, 3.0}, Width{4.0}, Height{4.0}, Hitpoints{1}},
     };
 
-    std::vector<std::shared_ptr<GameObject>> hitObjects =
-        reflectFromGameObjects(ball, std::vector<Wall>{},
-                               std::vector<IndestructibleBrick>{}, bricks);
+    std::vector<Hit> hitObjects;
+    reflectFromGameObjects(ball, std::vector<Wall>{},
+                           std::vector<IndestructibleBrick>{}, bricks,
+                           hitObjects);
 
     EXPECT_EQ(hitObjects.size(), hitObjectsCount);
     EXPECT_EQ(ball.topLeft().x, ballResultTopLeft.x);
@@ -167,7 +172,7 @@ INSTANTIATE_TEST_SUITE_P(
 
 class ReflectFromTwoObjectsWithStraightAndCornerParametersTests
     : public ::testing::TestWithParam<
-          std::tuple<Point, Point, Point, double, Point, double>> {
+          std::tuple<Point, Point, Point, Real, Point, Real>> {
 protected:
 };
 
@@ -188,9 +193,10 @@ TEST_P(ReflectFromTwoObjectsWithStraightAndCornerParametersTests, CheckResults)
         Brick{brick2TopLeft, Width{2.0}, Height{6.0}, Hitpoints{1}},
     };
 
-    std::vector<std::shared_ptr<GameObject>> hitObjects =
-        reflectFromGameObjects(ball, std::vector<Wall>{},
-                               std::vector<IndestructibleBrick>{}, bricks);
+    std::vector<Hit> hitObjects;
+    reflectFromGameObjects(ball, std::vector<Wall>{},
+                           std::vector<IndestructibleBrick>{}, bricks,
+                           hitObjects);
 
     EXPECT_EQ(hitObjects.size(), 2);
     EXPECT_EQ(ball.topLeft().x, ballResultTopLeft.x);
@@ -221,7 +227,7 @@ INSTANTIATE_TEST_SUITE_P(
 
 class ReflectFromThreeObjectsInCornerParametersTests
     : public ::testing::TestWithParam<
-          std::tuple<Point, Point, Point, Point, double, Point, double>> {
+          std::tuple<Point, Point, Point, Point, Real, Point, Real>> {
 protected:
 };
 
@@ -244,9 +250,10 @@ TEST_P(ReflectFromThreeObjectsInCornerParametersTests, CheckResults)
         Brick{brick3TopLeft, Width{3.0}, Height{3.0}, Hitpoints{1}},
     };
 
-    std::vector<std::shared_ptr<GameObject>> hitObjects =
-        reflectFromGameObjects(ball, std::vector<Wall>{},
-                               std::vector<IndestructibleBrick>{}, bricks);
+    std::vector<Hit> hitObjects;
+    reflectFromGameObjects(ball, std::vector<Wall>{},
+                           std::vector<IndestructibleBrick>{}, bricks,
+                           hitObjects);
 
     EXPECT_EQ(hitObjects.size(), 3);
     EXPECT_EQ(ball.topLeft().x, ballResultTopLeft.x);
@@ -268,6 +275,133 @@ INSTANTIATE_TEST_SUITE_P(
                         Point{2.0, 2.0}, 225.0_deg, Point{3.0, 3.0},
                         45.0_deg)));
 
+TEST(ReflectFromGameObjects, reportsHitsByKindAndIndex)
+{
+    Ball ball{Point{0.5, 2.0}, Width{3.0},      Height{1.0},
+              Velocity{1.0},   Angle{30.0_deg}, Gravity{0.0}};
+
+    std::vector<Brick> bricks{
+        Brick{Point{9.0, 9.0}, Width{1.0}, Height{1.0}, Hitpoints{1}},
+        Brick{Point{3.0, 1.0}, Width{4.0}, Height{4.0}, Hitpoints{2}},
+    };
+
+    std::vector<Hit> hits;
+    reflectFromGameObjects(ball, std::vector<Wall>{},
+                           std::vector<IndestructibleBrick>{}, bricks, hits);
+
+    ASSERT_EQ(hits.size(), 1);
+    EXPECT_EQ(hits[0].kind, ObjectKind::brick);
+    EXPECT_EQ(hits[0].index, 1);
+    EXPECT_EQ(hits[0].intersection,
+              bricks::game_objects::impl::Intersection::left);
+    EXPECT_EQ(hits[0].object, &bricks[1]);
+    EXPECT_EQ(bricks[1].hitpoints(), 1);
+}
+
+TEST(TimeOfImpact, checkResults)
+{
+    Ball ball{Point{0.0, 0.0}, Width{1.0},     Height{1.0},
+              Velocity{1.0},   Angle{0.0_deg}, Gravity{0.0}};
+    Brick brick{Point{5.0, 0.5}, Width{1.0}, Height{1.0}, Hitpoints{1}};
+
+    using bricks::game_objects::impl::timeOfImpact;
+
+    auto time = timeOfImpact(ball, Point{10.0, 0.0}, brick);
+    ASSERT_TRUE(time);
+    EXPECT_DOUBLE_EQ(*time, 0.4);
+
+    EXPECT_FALSE(timeOfImpact(ball, Point{2.0, 0.0}, brick));
+    EXPECT_FALSE(timeOfImpact(ball, Point{-10.0, 0.0}, brick));
+    EXPECT_FALSE(timeOfImpact(ball, Point{10.0, 5.0}, brick));
+
+    ball.setTopLeft(Point{4.5, 0.5});
+    EXPECT_FALSE(timeOfImpact(ball, Point{10.0, 0.0}, brick));
+}
+
+TEST(MoveToFirstContact, fastBallStopsAtThinBrick)
+{
+    Ball ball{Point{1.0, 5.0}, Width{0.75},     Height{0.75},
+              Velocity{1000.0}, Angle{0.0_deg}, Gravity{0.0}};
+    ball.activate();
+
+    std::vector<Brick> bricks{
+        Brick{Point{5.0, 4.0}, Width{0.25}, Height{3.0}, Hitpoints{1}}};
+    BrickGrid brickGrid{30, 10, bricks};
+    Platform platform{Point{1.0, 9.0}, Width{2.0}, Height{0.5},
+                      Velocity{1.0}};
+
+    auto remainingTimeMS = moveToFirstContact(
+        ball, 20.0, std::vector<Wall>{}, std::vector<IndestructibleBrick>{},
+        bricks, brickGrid, platform);
+
+    EXPECT_NEAR(ball.bottomRight().x, 5.0, 1e-5);
+    EXPECT_NEAR(remainingTimeMS, 16.75, 1e-5);
+
+    std::vector<Hit> hits;
+    reflectFromGameObjects(ball, std::vector<Wall>{},
+                           std::vector<IndestructibleBrick>{}, bricks,
+                           brickGrid, hits);
+    EXPECT_EQ(hits.size(), 1);
+    EXPECT_TRUE(bricks[0].isDestroyed());
+    EXPECT_LT(std::cos(ball.angle().get()), 0.0);
+}
+
+TEST(MoveToFirstContact, movesWholeWayWithoutContact)
+{
+    Ball ball{Point{1.0, 5.0}, Width{0.75},   Height{0.75},
+              Velocity{10.0},  Angle{0.0_deg}, Gravity{0.0}};
+    ball.activate();
+
+    std::vector<Brick> bricks;
+    BrickGrid brickGrid{30, 10, bricks};
+    Platform platform{Point{1.0, 9.0}, Width{2.0}, Height{0.5},
+                      Velocity{1.0}};
+
+    auto remainingTimeMS = moveToFirstContact(
+        ball, 100.0, std::vector<Wall>{}, std::vector<IndestructibleBrick>{},
+        bricks, brickGrid, platform);
+
+    EXPECT_EQ(remainingTimeMS, 0.0);
+    EXPECT_NEAR(ball.topLeft().x, 2.0, 1e-9);
+    EXPECT_NEAR(ball.topLeft().y, 5.0, 1e-9);
+}
+
+TEST(Deviate, staysWithinMaxDeviation)
+{
+    using bricks::game_objects::impl::deviate;
+
+    Random random{7};
+    for (int i = 0; i < 1000; ++i) {
+        auto angle = deviate(Angle{60.0_deg}, random, Angle{5.0_deg});
+        EXPECT_GE(angle.get(), 55.0_deg);
+        EXPECT_LE(angle.get(), 65.0_deg);
+    }
+}
+
+TEST(Deviate, isReproducibleWithSameSeed)
+{
+    using bricks::game_objects::impl::deviate;
+
+    Random a{42};
+    Random b{42};
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(deviate(Angle{120.0_deg}, a, Angle{5.0_deg}).get(),
+                  deviate(Angle{120.0_deg}, b, Angle{5.0_deg}).get());
+    }
+}
+
+TEST(Deviate, keepsClampedAngle)
+{
+    using bricks::game_objects::impl::deviate;
+
+    Random random{3};
+    for (int i = 0; i < 100; ++i) {
+        auto angle = deviate(Angle{30.0_deg}, random, Angle{5.0_deg});
+        EXPECT_GE(angle.get(), 30.0_deg - 1e-9);
+        EXPECT_LE(angle.get(), 35.0_deg);
+    }
+}
+
 class CalcAngleFactorParametersTests
     : public ::testing::TestWithParam<std::tuple<double, double>> {
 protected:
@@ -294,7 +428,7 @@ INSTANTIATE_TEST_SUITE_P(
                       std::make_tuple(2.0, 1.0)));
 
 class ClampAngleParametersTests
-    : public ::testing::TestWithParam<std::tuple<double, double>> {
+    : public ::testing::TestWithParam<std::tuple<Real, Real>> {
 protected:
 };
 
@@ -392,3 +526,49 @@ INSTANTIATE_TEST_SUITE_P(
                       std::make_tuple(350.0_deg, 330.0_deg),
                       std::make_tuple(355.0_deg, 330.0_deg),
                       std::make_tuple(360.0_deg, 360.0_deg)));
+
+using Corners = bricks::game_objects::impl::Corners;
+using Intersection = bricks::game_objects::impl::Intersection;
+
+using bricks::game_objects::impl::cornerBottomLeft;
+using bricks::game_objects::impl::cornerBottomRight;
+using bricks::game_objects::impl::cornerTopLeft;
+using bricks::game_objects::impl::cornerTopRight;
+
+class CornersToIntersectionParametersTests
+    : public ::testing::TestWithParam<
+          std::tuple<Corners, Intersection>> {
+protected:
+};
+
+TEST_P(CornersToIntersectionParametersTests, CheckResults)
+{
+    auto corners = std::get<0>(GetParam());
+    auto intersection = std::get<1>(GetParam());
+
+    EXPECT_EQ(bricks::game_objects::impl::cornersToIntersection(corners),
+              intersection);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    CornersToIntersectionTests, CornersToIntersectionParametersTests,
+    ::testing::Values(
+        std::make_tuple(0, Intersection::none),
+        std::make_tuple(cornerTopLeft, Intersection::topLeft),
+        std::make_tuple(cornerTopRight, Intersection::topRight),
+        std::make_tuple(cornerBottomRight,
+                        Intersection::bottomRight),
+        std::make_tuple(cornerBottomLeft, Intersection::bottomLeft),
+        std::make_tuple(cornerTopLeft | cornerBottomLeft,
+                        Intersection::left),
+        std::make_tuple(cornerTopLeft | cornerTopRight,
+                        Intersection::top),
+        std::make_tuple(cornerTopRight | cornerBottomRight,
+                        Intersection::right),
+        std::make_tuple(cornerBottomLeft | cornerBottomRight,
+                        Intersection::bottom),
+        std::make_tuple(cornerTopLeft | cornerBottomRight,
+                        Intersection::none),
+        std::make_tuple(cornerTopLeft | cornerTopRight |
+                            cornerBottomRight,
+                        Intersection::none)));
@@ -4,11 +4,14 @@
 
 #include "../../include/utility/OperatorDegree.h"
 
+#include "../RealTolerance.h"
+
 using namespace bricks;
 using namespace bricks::types::impl;
 using namespace bricks::utility;
 
 using Angle = bricks::types::Angle;
+using Real = bricks::types::Real;
 using Quadrant = bricks::types::Quadrant;
 
 TEST(AngleTest, defaultConstructor)
@@ -50,7 +53,7 @@ TEST(AngleTest, quadrant)
 
 class AngleMirrorHorizontalMultipleParametersTests
     : public ::testing::TestWithParam<
-          std::tuple<Quadrant, Quadrant, double, double>> {
+          std::tuple<Quadrant, Quadrant, Real, Real>> {
 protected:
 };
 
@@ -66,7 +69,7 @@ TEST_P(AngleMirrorHorizontalMultipleParametersTests, mirrorHorizontal)
 
     obj.mirrorHorizontal();
     EXPECT_EQ(obj.quadrant(), quadrantAfter);
-    EXPECT_NEAR(obj.get(), angleAfter, 0.000000001);
+    EXPECT_NEAR(obj.get(), angleAfter, test::realTolerance);
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -79,7 +82,7 @@ INSTANTIATE_TEST_SUITE_P(
 
 class AngleMirrorVerticalMultipleParametersTests
     : public ::testing::TestWithParam<
-          std::tuple<Quadrant, Quadrant, double, double>> {
+          std::tuple<Quadrant, Quadrant, Real, Real>> {
 protected:
 };
 
@@ -95,7 +98,7 @@ TEST_P(AngleMirrorVerticalMultipleParametersTests, mirrorVertical)
 
     obj.mirrorVertical();
     EXPECT_EQ(obj.quadrant(), quadrantAfter);
-    EXPECT_NEAR(obj.get(), angleAfter, 0.000000001);
+    EXPECT_NEAR(obj.get(), angleAfter, test::realTolerance);
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -223,18 +226,26 @@ INSTANTIATE_TEST_SUITE_P(
 
 TEST(calcAngleIfOutOfRange, Expected_result)
 {
-    EXPECT_DOUBLE_EQ(calcAngleIfOutOfRange(0.0_deg), 0.0_deg);
-    EXPECT_DOUBLE_EQ(calcAngleIfOutOfRange(360.0_deg), 360.0_deg);
-    EXPECT_DOUBLE_EQ(calcAngleIfOutOfRange(360.1_deg), 0.1_deg);
-    EXPECT_DOUBLE_EQ(calcAngleIfOutOfRange(540.0_deg), 180.0_deg);
-
-    EXPECT_DOUBLE_EQ(calcAngleIfOutOfRange(-0.1_deg), 359.9_deg);
-    EXPECT_DOUBLE_EQ(calcAngleIfOutOfRange(-360.0_deg), 0.0_deg);
-    EXPECT_DOUBLE_EQ(calcAngleIfOutOfRange(-540.0_deg), 180.0_deg);
+    // Subtracting 360 degrees cancels digits, so the error is about the one
+    // of 360 degrees
+    EXPECT_NEAR(calcAngleIfOutOfRange(0.0_deg), 0.0_deg, test::realTolerance);
+    EXPECT_NEAR(calcAngleIfOutOfRange(360.0_deg), 360.0_deg,
+                test::realTolerance);
+    EXPECT_NEAR(calcAngleIfOutOfRange(360.1_deg), 0.1_deg,
+                test::realTolerance);
+    EXPECT_NEAR(calcAngleIfOutOfRange(540.0_deg), 180.0_deg,
+                test::realTolerance);
+
+    EXPECT_NEAR(calcAngleIfOutOfRange(-0.1_deg), 359.9_deg,
+                test::realTolerance);
+    EXPECT_NEAR(calcAngleIfOutOfRange(-360.0_deg), 0.0_deg,
+                test::realTolerance);
+    EXPECT_NEAR(calcAngleIfOutOfRange(-540.0_deg), 180.0_deg,
+                test::realTolerance);
 }
 
 class CalcAngleIfOutOfRangeMultipleParametersTests
-    : public ::testing::TestWithParam<std::tuple<double, double>> {
+    : public ::testing::TestWithParam<std::tuple<Real, Real>> {
 protected:
 };
 
@@ -242,7 +253,8 @@ TEST_P(CalcAngleIfOutOfRangeMultipleParametersTests, CalcAngleIfOutOfRange)
 {
     auto angle = std::get<0>(GetParam());
     auto result_angle = std::get<1>(GetParam());
-    EXPECT_NEAR(calcAngleIfOutOfRange(angle), result_angle, 0.000000001);
+    EXPECT_NEAR(calcAngleIfOutOfRange(angle), result_angle,
+                test::realTolerance);
 }
 
 INSTANTIATE_TEST_SUITE_P(
@@ -31,3 +31,24 @@ TEST(IsNumberTest, double_expect_false)
 {
     EXPECT_FALSE(isNumber<double>("10N"));
 }
+
+TEST(IsNumberTest, parseNumber)
+{
+    EXPECT_EQ(parseNumber<int>("42"), 42);
+    EXPECT_EQ(parseNumber<int>("+42"), 42);
+    EXPECT_EQ(parseNumber<double>("-1.25"), -1.25);
+    EXPECT_EQ(parseNumber<double>("3"), 3.0);
+
+    EXPECT_FALSE(parseNumber<int>(""));
+    EXPECT_FALSE(parseNumber<int>("+"));
+    EXPECT_FALSE(parseNumber<int>("+-1"));
+    EXPECT_FALSE(parseNumber<int>("1 "));
+    EXPECT_FALSE(parseNumber<int>("99999999999"));
+    EXPECT_FALSE(parseNumber<double>("1.0x"));
+    EXPECT_FALSE(parseNumber<double>("nan"));
+    EXPECT_FALSE(parseNumber<double>("inf"));
+    EXPECT_FALSE(parseNumber<double>("-inf"));
+    EXPECT_FALSE(parseNumber<double>("+infinity"));
+    EXPECT_FALSE(parseNumber<double>("1e999"));
+    EXPECT_FALSE(parseNumber<std::size_t>("-1"));
+}
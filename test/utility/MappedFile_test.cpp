@@ -0,0 +1,48 @@
+#include "gtest/gtest.h"
+
+#include "../../include/utility/MappedFile.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+using namespace bricks::utility;
+
+TEST(MappedFile, mapsContent)
+{
+    auto filename =
+        (std::filesystem::temp_directory_path() / "mapped_file_test.bin")
+            .string();
+    {
+        std::ofstream ofs{filename, std::ios::binary};
+        ofs << "bricks";
+    }
+
+    {
+        MappedFile file{filename};
+        ASSERT_EQ(file.size(), 6);
+        EXPECT_EQ(std::memcmp(file.data(), "bricks", 6), 0);
+    }
+    std::filesystem::remove(filename);
+}
+
+TEST(MappedFile, emptyFile)
+{
+    auto filename =
+        (std::filesystem::temp_directory_path() / "mapped_file_empty.bin")
+            .string();
+    std::ofstream{filename};
+
+    {
+        MappedFile file{filename};
+        EXPECT_EQ(file.size(), 0);
+        EXPECT_EQ(file.data(), nullptr);
+    }
+    std::filesystem::remove(filename);
+}
+
+TEST(MappedFile, missingFileThrows)
+{
+    EXPECT_THROW(MappedFile{"does_not_exist.bin"}, std::runtime_error);
+}
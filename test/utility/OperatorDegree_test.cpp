@@ -2,29 +2,32 @@
 
 #include "../../include/utility/OperatorDegree.h"
 
+#include "../RealTolerance.h"
+
+using namespace bricks;
 using namespace bricks::utility;
 
 TEST(OperatorDegree, ValuesAreEqual_0)
 {
-    EXPECT_DOUBLE_EQ(0.0_deg, 0.0);
+    EXPECT_NEAR(0.0_deg, 0.0, test::realTolerance);
 }
 
 TEST(OperatorDegree, ValuesAreEqual_90)
 {
-    EXPECT_DOUBLE_EQ(90.0_deg, 1.5707963267948966);
+    EXPECT_NEAR(90.0_deg, 1.5707963267948966, test::realTolerance);
 }
 
 TEST(OperatorDegree, ValuesAreEqual_180)
 {
-    EXPECT_DOUBLE_EQ(180.0_deg, 3.1415926535897931);
+    EXPECT_NEAR(180.0_deg, 3.1415926535897931, test::realTolerance);
 }
 
 TEST(OperatorDegree, ValuesAreEqual_270)
 {
-    EXPECT_DOUBLE_EQ(270.0_deg, 4.7123889803846897);
+    EXPECT_NEAR(270.0_deg, 4.7123889803846897, test::realTolerance);
 }
 
 TEST(OperatorDegree, ValuesAreEqual_360)
 {
-    EXPECT_DOUBLE_EQ(360.0_deg, 6.2831853071795862);
+    EXPECT_NEAR(360.0_deg, 6.2831853071795862, test::realTolerance);
 }
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include "gtest/gtest.h"
+
+#include "../../include/utility/Random.h"
+
+#include <random>
+
+using namespace bricks::utility;
+
+TEST(Random, matchesReferenceSequence)
+{
+    Random random{0};
+    EXPECT_EQ(random(), 0x99ec5f36cb75f2b4ULL);
+    EXPECT_EQ(random(), 0xbf6e1f784956452aULL);
+    EXPECT_EQ(random(), 0x1a5f849d4933e6e0ULL);
+}
+
+TEST(Random, sameSeedGivesSameSequence)
+{
+    Random a{1234};
+    Random b{1234};
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(a(), b());
+    }
+}
+
+TEST(Random, differentSeedsGiveDifferentSequences)
+{
+    Random a{1};
+    Random b{2};
+    EXPECT_NE(a(), b());
+}
+
+TEST(Random, seedRestartsSequence)
+{
+    Random random{5};
+    auto first = random();
+    random();
+    random.seed(5);
+    EXPECT_EQ(random(), first);
+}
+
+TEST(Random, uniformStaysInRange)
+{
+    Random random{9};
+    double sum = 0.0;
+    constexpr int count = 10000;
+    for (int i = 0; i < count; ++i) {
+        auto value = random.uniform(-2.0, 3.0);
+        EXPECT_GE(value, -2.0);
+        EXPECT_LT(value, 3.0);
+        sum += value;
+    }
+    EXPECT_NEAR(sum / count, 0.5, 0.1);
+}
+
+TEST(Random, chanceHonorsLimits)
+{
+    Random random{11};
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_FALSE(random.chance(0.0));
+        EXPECT_TRUE(random.chance(1.0));
+    }
+}
+
+TEST(Random, worksWithStandardDistributions)
+{
+    Random random{13};
+    std::uniform_int_distribution<int> distribution{1, 6};
+    for (int i = 0; i < 100; ++i) {
+        auto value = distribution(random);
+        EXPECT_GE(value, 1);
+        EXPECT_LE(value, 6);
+    }
+}
@@ -0,0 +1,88 @@
+#include "gtest/gtest.h"
+
+#include "../../include/utility/ThreadPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+using namespace bricks::utility;
+
+TEST(ThreadPool, ThreadCountIsAtLeastOne)
+{
+    ThreadPool pool{0};
+
+    EXPECT_EQ(pool.threadCount(), 1);
+}
+
+TEST(ThreadPool, WaitWithoutTasks)
+{
+    ThreadPool pool{2};
+
+    pool.wait();
+}
+
+TEST(ThreadPool, RunsAllTasks)
+{
+    ThreadPool pool{4};
+    std::atomic<int> count{0};
+
+    for (int i = 0; i < 1000; ++i) {
+        pool.submit([&count]() { ++count; });
+    }
+    pool.wait();
+
+    EXPECT_EQ(count, 1000);
+}
+
+TEST(ThreadPool, CanBeReusedAfterWait)
+{
+    ThreadPool pool{2};
+    std::atomic<int> count{0};
+
+    pool.submit([&count]() { ++count; });
+    pool.wait();
+    pool.submit([&count]() { ++count; });
+    pool.wait();
+
+    EXPECT_EQ(count, 2);
+}
+
+TEST(ThreadPool, IdleThreadStealsTasksQueuedBehindBlockedTask)
+{
+    ThreadPool pool{2};
+    std::atomic<int> count{0};
+    constexpr int otherTasks{9};
+
+    // Tasks are queued alternating, so every second one waits behind the
+    // blocking task and can only run if it is stolen.
+    pool.submit([&count]() {
+        auto deadline =
+            std::chrono::steady_clock::now() + std::chrono::seconds{5};
+        while (count < otherTasks &&
+               std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+    });
+    for (int i = 0; i < otherTasks; ++i) {
+        pool.submit([&count]() { ++count; });
+    }
+    pool.wait();
+
+    EXPECT_EQ(count, otherTasks);
+}
+
+TEST(ThreadPool, WaitRethrowsException)
+{
+    ThreadPool pool{2};
+    std::atomic<int> count{0};
+
+    pool.submit([]() { throw std::runtime_error("task failed"); });
+    pool.submit([&count]() { ++count; });
+
+    EXPECT_THROW(pool.wait(), std::runtime_error);
+    EXPECT_EQ(count, 1);
+
+    pool.wait();
+}